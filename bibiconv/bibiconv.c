@@ -9,10 +9,12 @@
 #include "codetable.h"
 #include "marc8_tables.h"
 #include "iconv_coding.h"
+#include <ctype.h>
 #include <errno.h>
 #include <string.h>
-#include <ctype.h>
 #include <stdlib.h>
+#include <stdalign.h>
+#include <stdatomic.h>
 
 #if BIBICONV_HAS_NULLPTR
 #define nullfun nullptr
@@ -20,101 +22,629 @@
 #define nullfun ((uintptr_t)0)
 #endif
 
+/**
+ * The amount of bytes that an encoding uses for code points up to `U+007F`,
+ * `U+07FF`, `U+FFFF`, and `U+10FFFF`.
+ *
+ * These ranges are where the size of a UTF-8 code point changes, which makes
+ * them enough to bound the size of any conversion between two encodings.
+ */
+typedef unsigned char code_point_sizes_t[4];
+
+static code_point_sizes_t const marc8_sizes = { 1, 1, 1, 3 };
+static code_point_sizes_t const utf8_sizes = { 1, 2, 3, 4 };
+static code_point_sizes_t const utf16_sizes = { 2, 2, 2, 4 };
+static code_point_sizes_t const utf32_sizes = { 4, 4, 4, 4 };
+
 struct bib_iconv_s {
     struct bib_iconv_encoder_s encoder;
     struct bib_iconv_decoder_s decoder;
-    ucs4_t pending_write;
-    bool has_pending_write;
+
+    /**
+     * A specialized function converting directly between the two encodings,
+     * used instead of ``decoder`` and ``encoder`` when it's set.
+     */
+    size_t (*convert)(bib_iconv_t cd, bib_iconv_decoder_t d,
+                      char const **restrict src, size_t *restrict srcleft,
+                      char **restrict dst, size_t *restrict dstleft,
+                      ucs4_t *restrict pending, bool *restrict has_pending);
+
+    /**
+     * A specialized function measuring the output of ``convert`` without
+     * writing it, used by ``bib_iconv_measure`` when it's set.
+     */
+    size_t (*measure)(bib_iconv_t cd, bib_iconv_decoder_t d,
+                      char const **restrict src, size_t *restrict srcleft,
+                      size_t *restrict size);
+
+    /** The most bytes ``encoder`` writes for a code point in each range. */
+    code_point_sizes_t const *encoder_sizes;
+
+    /** The fewest bytes ``decoder`` reads for a code point in each range. */
+    code_point_sizes_t const *decoder_sizes;
+
+    /**
+     * The encoded bytes of a character that didn't fit in the destination
+     * buffer, which are written before anything else in the next conversion.
+     */
+    char staged[BIB_ICONV_MAX_WRITE_SIZE];
+
+    /** The index of the first byte in ``staged`` left to write. */
+    unsigned char staged_start;
+
+    /** The index after the last byte in ``staged`` left to write. */
+    unsigned char staged_end;
+
+    /** Indicates that the character in ``staged`` is a null character. */
+    bool is_staged_null;
+
+    /**
+     * Indicates that the last call to ``convert_buffer`` ended after writing a
+     * null character.
+     */
+    bool has_written_null;
+
     bool is_initialized;
+
+    /**
+     * Indicates that ``bib_iconv_open`` allocated the descriptor with
+     * ``allocator``, so that ``bib_iconv_close`` deallocates it.
+     */
+    bool is_allocated;
+
+    /** The allocator that allocated the descriptor. */
+    struct bib_iconv_allocator allocator;
+
+    /**
+     * The pool entry that the descriptor is released back into, when it was
+     * acquired from a pool.
+     */
+    struct pool_entry *pool_entry;
+
+    /** The next idle descriptor in the same pool entry. */
+    bib_iconv_t next_idle;
+};
+
+static void *malloc_allocate(void *context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static void malloc_deallocate(void *context, void *pointer) {
+    (void)context;
+    free(pointer);
+}
+
+/**
+ * The allocator used until another one is set with ``bib_iconv_set_allocator``.
+ */
+static struct bib_iconv_allocator const malloc_allocator = {
+    .allocate = malloc_allocate,
+    .deallocate = malloc_deallocate,
+    .context = nullptr,
 };
 
+/** The allocator used for memory that isn't given its own allocator. */
+static _Atomic(struct bib_iconv_allocator const *) global_allocator =
+    &malloc_allocator;
+
+void bib_iconv_set_allocator(struct bib_iconv_allocator const *allocator) {
+    if (allocator == nullptr) {
+        allocator = &malloc_allocator;
+    }
+    atomic_store_explicit(&global_allocator, allocator, memory_order_release);
+}
+
+/**
+ * Get the allocator set with ``bib_iconv_set_allocator``.
+ */
+static struct bib_iconv_allocator const *current_allocator(void) {
+    return atomic_load_explicit(&global_allocator, memory_order_acquire);
+}
+
+/**
+ * Allocate zero-filled memory with an allocator.
+ *
+ * - returns: The allocated memory, or `NULL` with `errno` set to `ENOMEM`
+ *   when it can't be allocated.
+ */
+static void *allocate_zeroed(struct bib_iconv_allocator const *allocator,
+                             size_t size) {
+    void *pointer = allocator->allocate(allocator->context, size);
+    if (pointer == nullptr) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    return memset(pointer, 0, size);
+}
+
 /**
- * Test a given encoding code against an expected value.
+ * Set up a zero-filled conversion descriptor with the encoder and decoder for
+ * the given character encodings.
  *
- * - parameter given: The encoding code to test.
- * - parameter expected: The encoding code to test against.
- * - returns: `0` when the given code matches the expected code, `-1` when the
- *   given code is ordered before the expected code, and `1` when the given code
- *   is ordered after the expected code.
+ * - parameter cd: The conversion descriptor to set up.
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - parameter normalization: How to normalize the converted text, which is
+ *   only supported when converting from MARC-8.
+ * - returns: `0` when the descriptor is set up, and `-1` when either
+ *   character encoding isn't supported.
  *
- * This function ignores `'-'` characters, and is case insensitive.
+ * The decoder's context isn't placed in memory until ``place_context`` is
+ * called.
  */
-static int matchcode(char const *given, char const *expected) {
-    while (*given != 0 && *expected != 0) {
-        unsigned char c1 = tolower(*given);
-        unsigned char c2 = tolower(*expected);
-        if (c1 == '-') {
-            given += 1;
-            continue;
-        }
-        if (c2 == '-') {
-            expected += 1;
-            continue;
-        }
-        if (c1 != c2) {
+static int setup_descriptor(bib_iconv_t cd, bib_iconv_encoding_t to,
+                            bib_iconv_encoding_t from,
+                            bib_iconv_normalization_t normalization) {
+    /* The fused converter to use when converting from MARC-8. */
+    size_t (*marc8_converter)(bib_iconv_t, bib_iconv_decoder_t,
+                              char const **restrict, size_t *restrict,
+                              char **restrict, size_t *restrict,
+                              ucs4_t *restrict, bool *restrict) = nullfun;
+
+    /* The fused measurement to use when converting from MARC-8. */
+    size_t (*marc8_measurer)(bib_iconv_t, bib_iconv_decoder_t,
+                             char const **restrict, size_t *restrict,
+                             size_t *restrict) = nullfun;
+
+    switch (to) {
+        case BIB_ICONV_UTF8:
+            bib_iconv_open_utf8_encoder(&cd->encoder);
+            cd->encoder_sizes = &utf8_sizes;
+            marc8_converter = bib_iconv_convert_marc8_to_utf8;
+            marc8_measurer = bib_iconv_measure_marc8_to_utf8;
             break;
-        }
-        given += 1;
-        expected += 1;
+        case BIB_ICONV_UTF16:
+            bib_iconv_open_utf16_encoder(&cd->encoder);
+            cd->encoder_sizes = &utf16_sizes;
+            marc8_converter = bib_iconv_convert_marc8_to_utf16;
+            marc8_measurer = bib_iconv_measure_marc8_to_utf16;
+            break;
+        case BIB_ICONV_UTF32:
+            bib_iconv_open_utf32_encoder(&cd->encoder);
+            cd->encoder_sizes = &utf32_sizes;
+            marc8_converter = bib_iconv_convert_marc8_to_utf32;
+            marc8_measurer = bib_iconv_measure_marc8_to_utf32;
+            break;
+        default:
+            /* There's no encoder for MARC-8 yet. */
+            errno = EINVAL;
+            return -1;
     }
-    if (*given == *expected) {
-        return 0;
-    } else if (*given < *expected) {
+
+    if (normalization != BIB_ICONV_NORMALIZE_NONE && from != BIB_ICONV_MARC8) {
+        /* Only the MARC-8 decoder normalizes the characters it decodes. */
+        errno = EINVAL;
         return -1;
-    } else {
-        return 1;
     }
+
+    switch (from) {
+        case BIB_ICONV_MARC8:
+            bib_iconv_open_marc8_normalizing_decoder(&cd->decoder,
+                                                     normalization);
+            cd->decoder_sizes = &marc8_sizes;
+            cd->convert = marc8_converter;
+            cd->measure = marc8_measurer;
+            break;
+        case BIB_ICONV_UTF8:
+            bib_iconv_open_utf8_decoder(&cd->decoder);
+            cd->decoder_sizes = &utf8_sizes;
+            if (to == BIB_ICONV_UTF8) {
+                cd->convert = bib_iconv_convert_utf8_to_utf8;
+                cd->measure = bib_iconv_measure_utf8_to_utf8;
+            }
+            break;
+        case BIB_ICONV_UTF16:
+            bib_iconv_open_utf16_decoder(&cd->decoder);
+            cd->decoder_sizes = &utf16_sizes;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            /* The decoder reads little-endian code units and the encoder
+             * writes native ones, so copying them only matches on
+             * little-endian machines. */
+            if (to == BIB_ICONV_UTF16) {
+                cd->convert = bib_iconv_convert_utf16_to_utf16;
+                cd->measure = bib_iconv_measure_utf16_to_utf16;
+            }
+#endif
+            break;
+        case BIB_ICONV_UTF32:
+            bib_iconv_open_utf32_decoder(&cd->decoder);
+            cd->decoder_sizes = &utf32_sizes;
+            if (to == BIB_ICONV_UTF32) {
+                cd->convert = bib_iconv_convert_utf32_to_utf32;
+                cd->measure = bib_iconv_measure_utf32_to_utf32;
+            }
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+
+    cd->is_initialized = false;
+    return 0;
 }
 
-bib_iconv_t bib_iconv_open(char const *restrict to, char const *restrict from) {
-    if (to == nullptr || strcmp(to, "") == 0) {
-        to = "char";
+/**
+ * The longest name of an encoding to convert text to, not counting the options
+ * after it, that ``target_encoding`` looks up.
+ */
+#define TARGET_NAME_SIZE 64
+
+/** The options that can follow `"//"` in the name of an encoding. */
+static struct {
+    char const *name;
+    bib_iconv_normalization_t normalization;
+} const target_options[] = {
+    { "CANONICAL", BIB_ICONV_NORMALIZE_ORDER },
+    { "NFC", BIB_ICONV_NORMALIZE_NFC },
+};
+
+/**
+ * Test whether an option matches a name, without regard to case.
+ */
+static bool is_option(char const *option, char const *name) {
+    for (; *name != '\0'; option += 1, name += 1) {
+        if (toupper((unsigned char)*option) != *name) {
+            return false;
+        }
+    }
+    return *option == '\0';
+}
+
+/**
+ * Look up the character encoding to convert text to, along with the option
+ * given after `"//"` at the end of its name.
+ *
+ * - parameter name: The name of a character encoding, optionally followed by
+ *   `"//CANONICAL"` to sort combining characters into canonical order, or by
+ *   `"//NFC"` to also compose them into Unicode Normalization Form C.
+ * - parameter normalization: Set to the normalization named by the option.
+ * - returns: The identified character encoding, or ``BIB_ICONV_UNKNOWN`` when
+ *   either the name or its option aren't recognized.
+ */
+static bib_iconv_encoding_t
+target_encoding(char const *name, bib_iconv_normalization_t *normalization) {
+    *normalization = BIB_ICONV_NORMALIZE_NONE;
+    char const *option = (name != nullptr) ? strstr(name, "//") : nullptr;
+    if (option == nullptr) {
+        return bib_iconv_encoding(name);
+    }
+    size_t const count = sizeof(target_options) / sizeof(target_options[0]);
+    size_t index = 0;
+    while (index < count
+           && !is_option(option + 2, target_options[index].name)) {
+        index += 1;
+    }
+    size_t const length = (size_t)(option - name);
+    if (index == count || length >= TARGET_NAME_SIZE) {
+        return BIB_ICONV_UNKNOWN;
+    }
+    char encoding_name[TARGET_NAME_SIZE];
+    memcpy(encoding_name, name, length);
+    encoding_name[length] = '\0';
+    *normalization = target_options[index].normalization;
+    return bib_iconv_encoding(encoding_name);
+}
+
+/**
+ * The offset from the start of a conversion descriptor to its decoder's
+ * context, which keeps the context aligned for any type.
+ */
+#define CONTEXT_OFFSET \
+    ((sizeof(struct bib_iconv_s) + alignof(max_align_t) - 1) \
+     / alignof(max_align_t) * alignof(max_align_t))
+
+static_assert(alignof(max_align_t) - 1 + CONTEXT_OFFSET
+              + BIB_ICONV_MAX_CONTEXT_SIZE <= BIB_ICONV_STORAGE_SIZE,
+              "A conversion descriptor must fit in its storage size.");
+
+/**
+ * Point a conversion descriptor's decoder at the zero-filled memory right
+ * after the descriptor, when the decoder has a context.
+ */
+static void place_context(bib_iconv_t cd) {
+    if (cd->decoder.context_size > 0) {
+        cd->decoder.context = (char *)cd + CONTEXT_OFFSET;
+    }
+}
+
+/**
+ * Allocate and set up a conversion descriptor for the given character
+ * encodings.
+ */
+static bib_iconv_t open_descriptor(bib_iconv_encoding_t to,
+                                   bib_iconv_encoding_t from,
+                                   bib_iconv_normalization_t normalization,
+                                   struct bib_iconv_allocator const *allocator) {
+    if (allocator == nullptr) {
+        allocator = current_allocator();
     }
-    if (from == nullptr || strcmp(from, "") == 0) {
-        from = "char";
+    struct bib_iconv_s descriptor = { 0 };
+    if (setup_descriptor(&descriptor, to, from, normalization) != 0) {
+        return (bib_iconv_t)-1;
     }
 
-    bib_iconv_t cd = calloc(1, sizeof(struct bib_iconv_s));
+    /* Allocate the descriptor together with its decoder's context. */
+    size_t const size = CONTEXT_OFFSET + descriptor.decoder.context_size;
+    bib_iconv_t cd = allocate_zeroed(allocator, size);
     if (cd == nullptr) {
-        errno = ENOMEM;
         return (bib_iconv_t)-1;
     }
+    *cd = descriptor;
+    cd->is_allocated = true;
+    cd->allocator = *allocator;
+    place_context(cd);
+    return cd;
+}
 
-    if (matchcode(to, "UTF-8") == 0 || matchcode(to, "char") == 0) {
-        bib_iconv_open_utf8_encoder(&cd->encoder);
-    } else if (matchcode(to, "UTF=16") == 0 || matchcode(to, "UCS-2") == 0) {
-        bib_iconv_open_utf16_encoder(&cd->encoder);
-    } else if (matchcode(to, "UTF-32") == 0 || matchcode(to, "UCS-4") == 0
-               || matchcode(to, "wchar") == 0
-               || matchcode(to, "wchar_t") == 0) {
-        bib_iconv_open_utf32_encoder(&cd->encoder);
-    } else {
-        free(cd);
+bib_iconv_t bib_iconv_open(char const *restrict to, char const *restrict from) {
+    bib_iconv_normalization_t normalization;
+    bib_iconv_encoding_t const target = target_encoding(to, &normalization);
+    return open_descriptor(target, bib_iconv_encoding(from), normalization,
+                           nullptr);
+}
+
+bib_iconv_t bib_iconv_open_id(bib_iconv_encoding_t to,
+                              bib_iconv_encoding_t from) {
+    return open_descriptor(to, from, BIB_ICONV_NORMALIZE_NONE, nullptr);
+}
+
+bib_iconv_t bib_iconv_open_allocator(char const *restrict to,
+                                     char const *restrict from,
+                                     struct bib_iconv_allocator const
+                                         *allocator) {
+    bib_iconv_normalization_t normalization;
+    bib_iconv_encoding_t const target = target_encoding(to, &normalization);
+    return open_descriptor(target, bib_iconv_encoding(from), normalization,
+                           allocator);
+}
+
+bib_iconv_t bib_iconv_init(void *storage, size_t size,
+                           char const *restrict to, char const *restrict from) {
+    if (storage == nullptr) {
         errno = EINVAL;
         return (bib_iconv_t)-1;
     }
+    struct bib_iconv_s descriptor = { 0 };
+    bib_iconv_normalization_t normalization;
+    bib_iconv_encoding_t const target = target_encoding(to, &normalization);
+    if (setup_descriptor(&descriptor, target, bib_iconv_encoding(from),
+                         normalization) != 0) {
+        return (bib_iconv_t)-1;
+    }
 
-    if (matchcode(from, "MARC-8") == 0 || matchcode(from, "ANSEL") == 0) {
-        bib_iconv_open_marc8_decoder(&cd->decoder);
-    } else if (matchcode(from, "UTF-8") == 0 || matchcode(from, "char") == 0) {
-        bib_iconv_open_utf8_decoder(&cd->decoder);
-    } else if (matchcode(from, "UTF-16") == 0
-               || matchcode(from, "UCS-2") == 0) {
-        bib_iconv_open_utf16_decoder(&cd->decoder);
-    } else if (matchcode(from, "UTF-32") == 0 || matchcode(from, "UCS-4") == 0
-               || matchcode(from, "wchar") == 0
-               || matchcode(from, "wchar_t") == 0) {
-        bib_iconv_open_utf32_decoder(&cd->decoder);
-    } else {
-        free(cd);
+    /* Align the descriptor within the storage. */
+    size_t const misalignment = (uintptr_t)storage % alignof(max_align_t);
+    size_t const padding = (misalignment == 0)
+                         ? 0 : alignof(max_align_t) - misalignment;
+    size_t const needed = CONTEXT_OFFSET + descriptor.decoder.context_size;
+    if (size < padding || size - padding < needed) {
         errno = EINVAL;
         return (bib_iconv_t)-1;
     }
-
-    cd->is_initialized = false;
+    bib_iconv_t cd = (bib_iconv_t)((char *)storage + padding);
+    memset(cd, 0, needed);
+    *cd = descriptor;
+    place_context(cd);
     return cd;
 }
 
+/**
+ * Initialize the encoder and decoder of a conversion descriptor at the start
+ * of a conversion.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter src: The source buffer of the conversion.
+ * - parameter srcleft: The amount of bytes left in the source buffer.
+ * - returns: `0` on successful initialization, and `(size_t)-1` on failure.
+ */
+static size_t begin_conversion(bib_iconv_t cd,
+                               char const **restrict src,
+                               size_t *restrict srcleft) {
+    if (cd->encoder.init != nullfun) {
+        cd->encoder.init(&cd->encoder);
+    }
+    if (cd->decoder.init != nullfun) {
+        size_t result = cd->decoder.init(cd, &cd->decoder, src, srcleft);
+        if (result == (size_t)-1) {
+            return result;
+        }
+    }
+    cd->is_initialized = true;
+    return 0;
+}
+
+/**
+ * Test whether the last code point written to a destination buffer was a null
+ * character, which ends a conversion.
+ *
+ * Every encoder writes whole code units, and only a null character encodes to
+ * a code unit of all zeros.
+ */
+static bool ends_with_null(bib_iconv_t cd, char const *buffer, size_t used) {
+    size_t const unit_size = (*cd->encoder_sizes)[0];
+    if (used < unit_size) {
+        return false;
+    }
+    for (size_t i = used - unit_size; i < used; i += 1) {
+        if (buffer[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Write as much of the staged character as fits in the destination buffer.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter dst: The destination buffer to write the staged bytes to.
+ * - parameter dstleft: The amount of bytes left in the destination buffer.
+ * - returns: `0` after writing every staged byte, and `(size_t)-1` with
+ *   `errno` set to `E2BIG` when some of them are still staged.
+ */
+static size_t write_staged(bib_iconv_t cd,
+                           char **restrict dst, size_t *restrict dstleft) {
+    size_t length = cd->staged_end - cd->staged_start;
+    bool const is_partial = *dstleft < length;
+    if (is_partial) {
+        length = *dstleft;
+    }
+    memcpy(*dst, cd->staged + cd->staged_start, length);
+    *dst += length;
+    *dstleft -= length;
+    cd->staged_start += length;
+    if (is_partial) {
+        errno = E2BIG;
+        return (size_t)-1;
+    }
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    return 0;
+}
+
+/**
+ * Stage a character that doesn't fit in the destination buffer, and write as
+ * much of it as fits.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter c: The code point that doesn't fit in the destination buffer.
+ * - parameter dst: The destination buffer to write the character to.
+ * - parameter dstleft: The amount of bytes left in the destination buffer.
+ * - returns: `(size_t)-1` with `errno` set to `E2BIG` after staging the
+ *   character, or to another value when it can't be encoded.
+ *
+ * Even a single byte left in the destination buffer gets part of the
+ * character, so every conversion makes progress.
+ */
+static size_t stage_write(bib_iconv_t cd, ucs4_t c,
+                          char **restrict dst, size_t *restrict dstleft) {
+    char *staged = cd->staged;
+    size_t stagedleft = sizeof(cd->staged);
+    if (cd->encoder.write(cd, &cd->encoder, c, &staged, &stagedleft)
+        == (size_t)-1) {
+        return (size_t)-1;
+    }
+    cd->staged_start = 0;
+    cd->staged_end = (unsigned char)(sizeof(cd->staged) - stagedleft);
+    cd->is_staged_null = c == 0;
+    if (write_staged(cd, dst, dstleft) == (size_t)-1) {
+        return (size_t)-1;
+    }
+    /* Only characters that don't fit are staged. */
+    errno = E2BIG;
+    return (size_t)-1;
+}
+
+/**
+ * Convert the characters in a source buffer into a destination buffer.
+ *
+ * This is the body of ``bib_iconv`` after the conversion has started, and the
+ * arguments have been checked.
+ */
+static size_t convert_buffer(bib_iconv_t cd,
+                             char const **restrict src,
+                             size_t *restrict srcleft,
+                             char **restrict dst,
+                             size_t *restrict dstleft) {
+    cd->has_written_null = false;
+    if (cd->staged_end > 0) {
+        if (write_staged(cd, dst, dstleft) == (size_t)-1) {
+            return (size_t)-1;
+        }
+        if (cd->is_staged_null) {
+            cd->has_written_null = true;
+            return 0;
+        }
+        if (*dstleft == 0) {
+            return 0;
+        }
+    }
+
+    if (cd->convert != nullfun) {
+        char const *const start = *dst;
+        ucs4_t pending = 0;
+        bool has_pending = false;
+        size_t result = cd->convert(cd, &cd->decoder, src, srcleft,
+                                    dst, dstleft, &pending, &has_pending);
+        if (result == (size_t)-1) {
+            if (has_pending && errno == E2BIG) {
+                return stage_write(cd, pending, dst, dstleft);
+            }
+            return result;
+        }
+        cd->has_written_null = ends_with_null(cd, start,
+                                              (size_t)(*dst - start));
+        return result;
+    }
+
+    size_t accumulated_result = 0;
+    bool const has_block_path = cd->decoder.read_block != nullfun
+                             && cd->encoder.write_block != nullfun;
+    while (true) {
+        size_t capacity = *dstleft / BIB_ICONV_MAX_WRITE_SIZE;
+        if (capacity > BIB_ICONV_BLOCK_SIZE) {
+            capacity = BIB_ICONV_BLOCK_SIZE;
+        }
+
+        if (has_block_path && capacity > 1) {
+            /* Decode as many code points as are guaranteed to fit in the
+             * destination buffer, then encode all of them at once. */
+            ucs4_t block[BIB_ICONV_BLOCK_SIZE];
+            size_t count = capacity;
+            size_t r = cd->decoder.read_block(cd, &cd->decoder, src, srcleft,
+                                              block, &count);
+            int const read_error = errno;
+
+            size_t written = count;
+            size_t result = cd->encoder.write_block(cd, &cd->encoder, block,
+                                                    &written, dst, dstleft);
+            if (result == (size_t)-1) {
+                /* The block always fits, so this is a code point that can't be
+                 * encoded. */
+                return result;
+            }
+            accumulated_result += result;
+
+            if (r == (size_t)-1) {
+                errno = read_error;
+                return r;
+            }
+            if (count > 0 && block[count - 1] == 0) {
+                cd->has_written_null = true;
+                return accumulated_result;
+            }
+            if (*dstleft == 0) {
+                return accumulated_result;
+            }
+            continue;
+        }
+
+        ucs4_t uni = 0;
+        size_t r = cd->decoder.read(cd, &cd->decoder, src, srcleft, &uni);
+        if (r == (size_t)-1) {
+            return r;
+        }
+
+        size_t result = cd->encoder.write(cd, &cd->encoder, uni, dst, dstleft);
+        if (result == (size_t)-1) {
+            if (errno == E2BIG) {
+                return stage_write(cd, uni, dst, dstleft);
+            }
+            return result;
+        }
+
+        accumulated_result += result;
+        if (uni == 0) {
+            cd->has_written_null = true;
+            return accumulated_result;
+        }
+        if (*dstleft == 0) {
+            return accumulated_result;
+        }
+    }
+}
+
 size_t bib_iconv(bib_iconv_t cd,
                  char const **restrict src, size_t *restrict srcleft,
                  char **restrict dst, size_t *restrict dstleft) {
@@ -124,30 +654,17 @@ size_t bib_iconv(bib_iconv_t cd,
     }
 
     if (!cd->is_initialized) {
-        if (cd->encoder.init != nullfun) {
-            cd->encoder.init(&cd->encoder);
-        }
-        if (cd->decoder.init != nullfun) {
-            size_t result = cd->decoder.init(cd, &cd->decoder, src, srcleft);
-            if (result == (size_t)-1) {
-                return result;
-            }
+        size_t result = begin_conversion(cd, src, srcleft);
+        if (result == (size_t)-1) {
+            return result;
         }
-        cd->is_initialized = true;
     }
 
     if (src == nullptr || *src == nullptr) {
         if (dst != nullptr && *dst != nullptr) {
             size_t result = 0;
-            if (cd->has_pending_write) {
-                size_t r = cd->encoder.write(cd, &cd->encoder,
-                                             cd->pending_write, dst, dstleft);
-                if (r == (size_t)-1) {
-                    return r;
-                }
-                result += r;
-                cd->pending_write = 0;
-                cd->has_pending_write = false;
+            if (write_staged(cd, dst, dstleft) == (size_t)-1) {
+                return (size_t)-1;
             }
             if (cd->encoder.flush != nullfun) {
                 size_t r = cd->encoder.flush(cd, &cd->encoder, dst, dstleft);
@@ -159,61 +676,1292 @@ size_t bib_iconv(bib_iconv_t cd,
             cd->is_initialized = false;
             return result;
         } else {
-            cd->pending_write = 0;
-            cd->has_pending_write = false;
+            cd->staged_start = 0;
+            cd->staged_end = 0;
             cd->is_initialized = false;
             return 0;
         }
     }
 
-    if (srcleft == nullptr || *srcleft == 0) {
+    if (srcleft == nullptr) {
         return 0;
     }
 
+    /* With an empty source buffer, only the characters that the decoder still
+     * holds are written, such as combining characters read along with the
+     * character they modify. */
+    bool const is_draining = *srcleft == 0;
     if (dst == nullptr || *dst == nullptr || dstleft == nullptr) {
+        if (is_draining) {
+            return 0;
+        }
         errno = EINVAL;
         return (size_t)-1;
     }
 
-    size_t accumulated_result = 0;
-    while (true) {
-        ucs4_t uni = 0;
+    size_t result = convert_buffer(cd, src, srcleft, dst, dstleft);
+    if (result == (size_t)-1 && is_draining && errno == EINVAL) {
+        return 0;
+    }
+    return result;
+}
 
-        if (cd->has_pending_write) {
-            uni = cd->pending_write;
-            cd->pending_write = 0;
-            cd->has_pending_write = false;
-        } else {
-            size_t r = cd->decoder.read(cd, &cd->decoder, src, srcleft, &uni);
-            if (r == (size_t)-1) {
-                return r;
-            }
-        }
+/**
+ * The most bytes of a character split between source buffers that
+ * ``bib_iconv_iov`` copies together to read as a whole.
+ *
+ * This is enough for the longest run of MARC-8 combining characters followed
+ * by the multibyte character they modify.
+ */
+#define IOV_STITCH_SIZE 256
 
-        size_t result = cd->encoder.write(cd, &cd->encoder, uni, dst, dstleft);
-        if (result == (size_t)-1) {
-            cd->pending_write = uni;
-            cd->has_pending_write = true;
-            return result;
-        }
+/**
+ * Advance through a list of buffers past the given amount of bytes.
+ *
+ * - parameter iov: The buffers to advance through, in order.
+ * - parameter count: The amount of buffers in `iov`.
+ * - parameter size: The amount of bytes to advance past.
+ */
+static void advance_iov(struct iovec *iov, int count, size_t size) {
+    for (int index = 0; index < count && size > 0; index += 1) {
+        size_t const length = (size < iov[index].iov_len)
+                            ? size : iov[index].iov_len;
+        iov[index].iov_base = (char *)iov[index].iov_base + length;
+        iov[index].iov_len -= length;
+        size -= length;
+    }
+}
 
-        accumulated_result += result;
-        if (uni == 0 || *dstleft == 0) {
-            return accumulated_result;
+/**
+ * Copy bytes from the start of a list of buffers into a single buffer,
+ * without advancing through them.
+ *
+ * - parameter iov: The buffers to copy from, in order.
+ * - parameter count: The amount of buffers in `iov`.
+ * - parameter buffer: The buffer to copy bytes to.
+ * - parameter capacity: The most bytes to copy into `buffer`.
+ * - returns: The amount of bytes copied into `buffer`.
+ */
+static size_t gather_iov(struct iovec const *iov, int count,
+                         char *buffer, size_t capacity) {
+    size_t size = 0;
+    for (int index = 0; index < count && size < capacity; index += 1) {
+        size_t length = capacity - size;
+        if (length > iov[index].iov_len) {
+            length = iov[index].iov_len;
         }
+        memcpy(buffer + size, iov[index].iov_base, length);
+        size += length;
     }
+    return size;
 }
 
-int bib_iconv_close(bib_iconv_t cd) {
-    if (cd == nullptr) {
-        return 0;
+/**
+ * Flush the remaining state from a conversion descriptor into a list of
+ * buffers, like calling ``bib_iconv`` with a `NULL` source buffer.
+ *
+ * - parameter cd: The conversion descriptor to flush.
+ * - parameter out: The buffers to write to, in order, which are advanced past
+ *   the written bytes.
+ * - parameter nout: The amount of buffers in `out`.
+ * - returns: The result of flushing the descriptor, or `(size_t)-1` on failure.
+ */
+static size_t flush_iov(bib_iconv_t cd, struct iovec *out, int nout) {
+    int o = 0;
+    while (true) {
+        while (o < nout && out[o].iov_len == 0) {
+            o += 1;
+        }
+        char empty = 0;
+        char *dst = (o < nout) ? out[o].iov_base : &empty;
+        size_t dstleft = (o < nout) ? out[o].iov_len : 0;
+        size_t result = bib_iconv(cd, nullptr, nullptr, &dst, &dstleft);
+        if (o < nout) {
+            advance_iov(out + o, 1, out[o].iov_len - dstleft);
+        }
+        if (result != (size_t)-1 || errno != E2BIG || o == nout) {
+            return result;
+        }
+        /* The rest of a staged character goes in the next buffer. */
     }
-    if (cd->encoder.deinit != nullfun) {
-        cd->encoder.deinit(&cd->encoder);
+}
+
+size_t bib_iconv_iov(bib_iconv_t cd, struct iovec *in, int nin,
+                     struct iovec *out, int nout) {
+    if (cd == nullptr || nin < 0 || nout < 0
+        || (in == nullptr && nin > 0) || (out == nullptr && nout > 0)) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    if (in == nullptr) {
+        return flush_iov(cd, out, nout);
+    }
+
+    size_t accumulated_result = 0;
+    int i = 0;
+    int o = 0;
+    bool should_stitch = false;
+    while (true) {
+        while (i < nin && in[i].iov_len == 0) {
+            i += 1;
+        }
+        while (o < nout && out[o].iov_len == 0) {
+            o += 1;
+        }
+
+        /* Once every source buffer is empty, keep converting an empty source
+         * buffer to write the characters that the decoder still holds. */
+        bool const is_draining = i == nin;
+        if (!is_draining && o == nout) {
+            errno = E2BIG;
+            return (size_t)-1;
+        }
+
+        /* Read straight from the source buffer, unless a character is split
+         * between it and the next, in which case the character's bytes are
+         * copied together with the bytes that follow it. */
+        char stitch[IOV_STITCH_SIZE];
+        char const *src = stitch;
+        size_t srclen = 0;
+        if (should_stitch) {
+            srclen = gather_iov(in + i, nin - i, stitch, sizeof(stitch));
+        } else if (!is_draining) {
+            src = in[i].iov_base;
+            srclen = in[i].iov_len;
+        }
+        size_t srcleft = srclen;
+        char *dst = (o < nout) ? out[o].iov_base : stitch;
+        size_t dstleft = (o < nout) ? out[o].iov_len : 0;
+        char const *const start = dst;
+        size_t result = bib_iconv(cd, &src, &srcleft, &dst, &dstleft);
+        int const error = errno;
+        advance_iov(in + i, nin - i, srclen - srcleft);
+        advance_iov(out + o, nout - o, (size_t)(dst - start));
+
+        bool const was_stitched = should_stitch;
+        should_stitch = false;
+        if (result != (size_t)-1) {
+            accumulated_result += result;
+            if (cd->has_written_null) {
+                /* The conversion ended with a null character. */
+                return accumulated_result;
+            }
+            if (is_draining && (dstleft > 0 || o == nout)) {
+                return accumulated_result;
+            }
+        } else if (error == E2BIG && o < nout) {
+            /* The character that doesn't fit was staged and written up to the
+             * end of this buffer, so the rest of it goes in the next one. */
+        } else if (error == EINVAL && srcleft == 0) {
+            /* The source buffer ended between two characters. */
+        } else if (error == EINVAL && !was_stitched) {
+            /* The source buffer ended in the middle of a character, which
+             * may continue in the next source buffer. */
+            int next = i + 1;
+            while (next < nin && in[next].iov_len == 0) {
+                next += 1;
+            }
+            if (next == nin) {
+                errno = error;
+                return (size_t)-1;
+            }
+            should_stitch = true;
+        } else if (error == EINVAL && srcleft < srclen) {
+            /* Some characters were read from the stitched buffers, so read
+             * the rest from the source buffers themselves. */
+        } else {
+            errno = error;
+            return (size_t)-1;
+        }
+    }
+}
+
+/**
+ * Convert one of the strings in a batch from the start of a conversion.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter span: The source string to convert.
+ * - parameter dst: The destination buffer to write the converted string to.
+ * - parameter dstleft: The amount of bytes left in the destination buffer.
+ * - returns: `0` after converting the whole string, or the `errno` value
+ *   identifying the reason for the conversion failure.
+ */
+static int convert_span(bib_iconv_t cd, struct bib_span span,
+                        char **restrict dst, size_t *restrict dstleft) {
+    char const *src = span.data;
+    size_t srcleft = span.length;
+    if (begin_conversion(cd, &src, &srcleft) == (size_t)-1) {
+        return errno;
+    }
+    while (true) {
+        size_t result = convert_buffer(cd, &src, &srcleft, dst, dstleft);
+        if (result == (size_t)-1) {
+            if (errno == EINVAL && srcleft == 0) {
+                break;
+            }
+            return errno;
+        }
+        /* Once the destination buffer is full, keep going to find out whether
+         * there's anything left of the string to write. */
+        if (*dstleft > 0 || cd->has_written_null) {
+            break;
+        }
+    }
+    if (cd->encoder.flush != nullfun) {
+        if (cd->encoder.flush(cd, &cd->encoder, dst, dstleft) == (size_t)-1) {
+            return errno;
+        }
+    }
+    return 0;
+}
+
+size_t bib_iconv_batch(bib_iconv_t cd, size_t n,
+                       struct bib_span const *restrict in,
+                       struct bib_span *restrict out, int *restrict status,
+                       char *dst, size_t dstlen) {
+    if (cd == nullptr || (n > 0 && (in == nullptr || out == nullptr
+                                    || status == nullptr || dst == nullptr))) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+
+    size_t index = 0;
+    for (; index < n; index += 1) {
+        char *const start = dst;
+        size_t const startlen = dstlen;
+        int const error = convert_span(cd, in[index], &dst, &dstlen);
+        cd->staged_start = 0;
+        cd->staged_end = 0;
+        cd->is_initialized = false;
+        if (error != 0) {
+            /* Discard whatever was written of a string that failed. */
+            dst = start;
+            dstlen = startlen;
+        }
+        out[index] = (struct bib_span){ start, (size_t)(dst - start) };
+        status[index] = error;
+        if (error == E2BIG) {
+            break;
+        }
+    }
+    return index;
+}
+
+/**
+ * Measure the output of the generic conversion path, by decoding blocks of
+ * code points and encoding them into a scratch buffer.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter src: The source buffer to read encoded data from.
+ * - parameter srcleft: The amount of bytes left in the source buffer.
+ * - parameter size: The location to store the amount of bytes written.
+ * - returns: `0` upon a successful measurement, and `(size_t)-1` on failure.
+ */
+static size_t measure_blocks(bib_iconv_t cd,
+                             char const **restrict src,
+                             size_t *restrict srcleft,
+                             size_t *restrict size) {
+    char scratch[BIB_ICONV_BLOCK_SIZE * BIB_ICONV_MAX_WRITE_SIZE];
+    bool const has_block_path = cd->decoder.read_block != nullfun
+                             && cd->encoder.write_block != nullfun;
+    while (true) {
+        ucs4_t block[BIB_ICONV_BLOCK_SIZE];
+        size_t count = 1;
+        size_t r = 0;
+        if (has_block_path) {
+            count = BIB_ICONV_BLOCK_SIZE;
+            r = cd->decoder.read_block(cd, &cd->decoder, src, srcleft,
+                                       block, &count);
+        } else {
+            r = cd->decoder.read(cd, &cd->decoder, src, srcleft, block);
+            count = (r == (size_t)-1) ? 0 : 1;
+        }
+        int const read_error = errno;
+
+        char *dst = scratch;
+        size_t dstleft = sizeof(scratch);
+        size_t written = count;
+        size_t result = 0;
+        if (has_block_path) {
+            result = cd->encoder.write_block(cd, &cd->encoder, block,
+                                             &written, &dst, &dstleft);
+        } else if (count > 0) {
+            result = cd->encoder.write(cd, &cd->encoder, block[0],
+                                       &dst, &dstleft);
+        }
+        *size += sizeof(scratch) - dstleft;
+        if (result == (size_t)-1) {
+            return result;
+        }
+
+        if (r == (size_t)-1) {
+            errno = read_error;
+            return r;
+        }
+        if (count > 0 && block[count - 1] == 0) {
+            return 0;
+        }
+    }
+}
+
+/**
+ * Measure converted text with the descriptor's fused measuring function, or
+ * with ``measure_blocks`` when it doesn't have one.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter src: The source buffer to read encoded data from.
+ * - parameter srcleft: The amount of bytes left in the source buffer.
+ * - parameter size: The location to store the amount of bytes written.
+ * - returns: `0` upon a successful measurement, and `(size_t)-1` on failure.
+ */
+static size_t measure_source(bib_iconv_t cd,
+                             char const **restrict src,
+                             size_t *restrict srcleft,
+                             size_t *restrict size) {
+    if (cd->measure != nullfun) {
+        return cd->measure(cd, &cd->decoder, src, srcleft, size);
+    }
+    return measure_blocks(cd, src, srcleft, size);
+}
+
+size_t bib_iconv_measure(bib_iconv_t cd, char const *src, size_t srclen,
+                         size_t *dstlen) {
+    if (cd == nullptr || src == nullptr || dstlen == nullptr) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    *dstlen = 0;
+
+    /* Measure from the start of a conversion, and leave the descriptor ready
+     * to start the measured conversion over again. */
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    size_t result = begin_conversion(cd, &src, &srclen);
+    if (result == (size_t)-1) {
+        return result;
+    }
+    if (srclen == 0) {
+        cd->is_initialized = false;
+        return 0;
+    }
+    result = measure_source(cd, &src, &srclen, dstlen);
+    cd->is_initialized = false;
+    if (result == (size_t)-1 && errno == EINVAL && srclen == 0) {
+        /* The source string ended between characters, which ends the
+         * conversion just like a null character. */
+        return 0;
+    }
+    return result;
+}
+
+/** A point in indexed source text where decoding can resume. */
+struct checkpoint {
+    /** The offset of the point from the start of the source text. */
+    size_t offset;
+
+    /** The decoder's shift state at the point. */
+    bib_iconv_shift_state_t state;
+};
+
+struct bib_iconv_index_s {
+    /** The allocator that allocated the index. */
+    struct bib_iconv_allocator allocator;
+
+    /**
+     * The decoder's ``bib_iconv_decoder_s/read`` function, identifying the
+     * source encoding of the indexed text.
+     */
+    size_t (*read)(bib_iconv_t cd, struct bib_iconv_decoder_s *d,
+                   char const **restrict src, size_t *restrict srcleft,
+                   ucs4_t *unicode);
+
+    /** The amount of bytes of source text that were indexed. */
+    size_t length;
+
+    /** The amount of checkpoints in ``checkpoints``. */
+    size_t count;
+
+    /** The checkpoints, ordered by offset, starting at offset `0`. */
+    struct checkpoint checkpoints[];
+};
+
+/**
+ * Add a checkpoint for the descriptor's current shift state to an index.
+ *
+ * - parameter cd: The conversion descriptor, stopped between two characters.
+ * - parameter index: The index to add the checkpoint to.
+ * - parameter offset: The offset of the point where the descriptor stopped.
+ */
+static void add_checkpoint(bib_iconv_t cd, bib_iconv_index_t index,
+                           size_t offset) {
+    struct checkpoint *checkpoint = &index->checkpoints[index->count];
+    checkpoint->offset = offset;
+    checkpoint->state = (bib_iconv_shift_state_t){ 0 };
+    if (cd->decoder.save != nullfun) {
+        cd->decoder.save(&cd->decoder, &checkpoint->state);
+    }
+    index->count += 1;
+}
+
+/**
+ * Measure source text one interval at a time, adding a checkpoint at the
+ * character boundary where each interval stops.
+ *
+ * - parameter cd: The conversion descriptor, at the start of a conversion.
+ * - parameter index: The index to add checkpoints to, with room for one
+ *   checkpoint per interval.
+ * - parameter src: The source text to index.
+ * - parameter srclen: The amount of bytes in the source text.
+ * - parameter interval: The amount of bytes between checkpoints.
+ * - returns: `0` once the whole source text is indexed, and `(size_t)-1` on
+ *   failure.
+ */
+static size_t index_source(bib_iconv_t cd, bib_iconv_index_t index,
+                           char const *src, size_t srclen, size_t interval) {
+    char const *cursor = src;
+    size_t limit = 0;
+    add_checkpoint(cd, index, 0);
+    while (limit < srclen) {
+        limit = (interval < srclen - limit) ? limit + interval : srclen;
+        size_t offset = (size_t)(cursor - src);
+        size_t left = limit - offset;
+        size_t size = 0;
+        size_t result = measure_source(cd, &cursor, &left, &size);
+        offset = (size_t)(cursor - src);
+        index->length = offset;
+        if (result != (size_t)-1) {
+            /* Converting a null character ends the conversion, so the text
+             * after it isn't indexed. */
+            return 0;
+        }
+        if (errno != EINVAL || (limit == srclen && left > 0)) {
+            return result;
+        }
+        /* Measuring stops between characters at the end of an interval, or
+         * before a character that spans into the next interval. */
+        if (limit < srclen
+            && offset > index->checkpoints[index->count - 1].offset) {
+            add_checkpoint(cd, index, offset);
+        }
+    }
+    return 0;
+}
+
+bib_iconv_index_t bib_iconv_index_create(bib_iconv_t cd, char const *src,
+                                         size_t srclen, size_t interval) {
+    if (cd == nullptr || src == nullptr || interval == 0) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    size_t const capacity = srclen / interval + 1;
+    size_t const header = sizeof(struct bib_iconv_index_s);
+    if (capacity > (SIZE_MAX - header) / sizeof(struct checkpoint)) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    struct bib_iconv_allocator const *allocator = current_allocator();
+    bib_iconv_index_t index =
+        allocate_zeroed(allocator,
+                        header + capacity * sizeof(struct checkpoint));
+    if (index == nullptr) {
+        return nullptr;
+    }
+    index->allocator = *allocator;
+    index->read = cd->decoder.read;
+
+    /* Index from the start of a conversion, and leave the descriptor ready to
+     * start the indexed conversion over again. */
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    size_t result = begin_conversion(cd, &src, &srclen);
+    if (result != (size_t)-1) {
+        result = index_source(cd, index, src, srclen, interval);
+    }
+    cd->is_initialized = false;
+    if (result == (size_t)-1) {
+        int const error = errno;
+        bib_iconv_index_destroy(index);
+        errno = error;
+        return nullptr;
+    }
+    return index;
+}
+
+void bib_iconv_index_destroy(bib_iconv_index_t index) {
+    if (index == nullptr) {
+        return;
+    }
+    struct bib_iconv_allocator const allocator = index->allocator;
+    allocator.deallocate(allocator.context, index);
+}
+
+int bib_iconv_seek(bib_iconv_t cd, bib_iconv_index_t index,
+                   char const *src, size_t offset) {
+    if (cd == nullptr || index == nullptr || src == nullptr
+        || offset > index->length || cd->decoder.read != index->read) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* Find the last checkpoint at or before the offset. */
+    size_t low = 0;
+    size_t high = index->count;
+    while (high - low > 1) {
+        size_t const middle = low + (high - low) / 2;
+        if (index->checkpoints[middle].offset <= offset) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    struct checkpoint const *checkpoint = &index->checkpoints[low];
+
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    char const *cursor = src + checkpoint->offset;
+    size_t left = offset - checkpoint->offset;
+    if (begin_conversion(cd, &cursor, &left) == (size_t)-1) {
+        return -1;
+    }
+    if (cd->decoder.restore != nullfun) {
+        cd->decoder.restore(&cd->decoder, &checkpoint->state);
+    }
+    if (left == 0) {
+        return 0;
+    }
+
+    /* Decode the rest of the way from the checkpoint to the offset, which
+     * must end between two characters. */
+    size_t size = 0;
+    size_t const result = measure_source(cd, &cursor, &left, &size);
+    if (left > 0 || (result == (size_t)-1 && errno != EINVAL)) {
+        int const error = (result == (size_t)-1 && errno == EILSEQ)
+                        ? EILSEQ : EINVAL;
+        cd->is_initialized = false;
+        errno = error;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Bound the amount of bytes that converting a source string can write.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter srclen: The amount of bytes in the source string.
+ * - returns: The most bytes that converting `srclen` bytes can write, or
+ *   `SIZE_MAX` when that's too large to represent.
+ *
+ * Each range of code points grows by at most the ratio of its encoded sizes,
+ * so the largest of those ratios bounds the whole conversion. MARC-8 text
+ * converted to UTF-8 grows by at most 3 times, since every character needing
+ * 4 bytes of UTF-8 takes 3 bytes of MARC-8.
+ */
+static size_t bound_conversion(bib_iconv_t cd, size_t srclen) {
+    code_point_sizes_t const *to = cd->encoder_sizes;
+    code_point_sizes_t const *from = cd->decoder_sizes;
+    size_t output = (*to)[0];
+    size_t input = (*from)[0];
+    for (size_t i = 1; i < sizeof(code_point_sizes_t); i += 1) {
+        if ((*to)[i] * input > output * (*from)[i]) {
+            output = (*to)[i];
+            input = (*from)[i];
+        }
+    }
+    size_t const whole = srclen / input;
+    size_t const part = (srclen % input * output + input - 1) / input;
+    if (whole > (SIZE_MAX - part) / output) {
+        return SIZE_MAX;
+    }
+    return whole * output + part;
+}
+
+/**
+ * Convert a whole source string into a destination buffer, starting from the
+ * beginning of a conversion.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter src: The source string to convert.
+ * - parameter srclen: The amount of bytes in the source string.
+ * - parameter buffer: The destination buffer.
+ * - parameter capacity: The size of the destination buffer.
+ * - parameter used: The location to store the amount of bytes written.
+ * - returns: The result of ``bib_iconv``, with `E2BIG` when the converted
+ *   text doesn't fit in the destination buffer.
+ */
+static size_t convert_whole(bib_iconv_t cd, char const *src, size_t srclen,
+                            char *buffer, size_t capacity,
+                            size_t *restrict used) {
+    char *dst = buffer;
+    size_t dstleft = capacity;
+    size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstleft);
+    *used = capacity - dstleft;
+    if (result == (size_t)-1) {
+        if (errno != EINVAL || srclen != 0) {
+            return result;
+        }
+        /* The source string ended between characters, which ends the
+         * conversion just like a null character. */
+        result = 0;
+    } else if (dstleft == 0 && srclen > 0 && !cd->has_written_null) {
+        /* The conversion stopped only because the buffer filled up. */
+        errno = E2BIG;
+        return (size_t)-1;
+    }
+    size_t const r = bib_iconv(cd, nullptr, nullptr, &dst, &dstleft);
+    *used = capacity - dstleft;
+    if (r == (size_t)-1) {
+        return r;
+    }
+    return result + r;
+}
+
+size_t bib_iconv_convert_alloc(char const *restrict to,
+                               char const *restrict from,
+                               char const *src, size_t srclen,
+                               char **restrict out, size_t *restrict outlen,
+                               struct bib_iconv_allocator const *allocator) {
+    if (src == nullptr || out == nullptr || outlen == nullptr) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    *out = nullptr;
+    *outlen = 0;
+    if (allocator == nullptr) {
+        allocator = current_allocator();
+    }
+
+    unsigned char storage[BIB_ICONV_STORAGE_SIZE];
+    bib_iconv_t cd = bib_iconv_init(storage, sizeof(storage), to, from);
+    if (cd == (bib_iconv_t)-1) {
+        return (size_t)-1;
+    }
+    if (srclen == 0) {
+        bib_iconv_close(cd);
+        return 0;
+    }
+
+    /* Start with enough space for the longest possible conversion, so that
+     * the whole string is converted in one pass. */
+    size_t capacity = bound_conversion(cd, srclen);
+    if (capacity < BIB_ICONV_MAX_WRITE_SIZE) {
+        capacity = BIB_ICONV_MAX_WRITE_SIZE;
+    }
+    while (true) {
+        char *buffer = allocator->allocate(allocator->context, capacity);
+        if (buffer == nullptr) {
+            bib_iconv_close(cd);
+            errno = ENOMEM;
+            return (size_t)-1;
+        }
+        size_t used = 0;
+        size_t result = convert_whole(cd, src, srclen, buffer, capacity,
+                                      &used);
+        if (result != (size_t)-1) {
+            bib_iconv_close(cd);
+            *out = buffer;
+            *outlen = used;
+            return result;
+        }
+        int const error = errno;
+        allocator->deallocate(allocator->context, buffer);
+        if (error != E2BIG || capacity > SIZE_MAX / 2) {
+            bib_iconv_close(cd);
+            errno = (error == E2BIG) ? ENOMEM : error;
+            return (size_t)-1;
+        }
+        /* The bound should never be too small, but if it is, start over with
+         * twice as much space, so that the amount of work done stays linear
+         * in the size of the converted text. */
+        bib_iconv(cd, nullptr, nullptr, nullptr, nullptr);
+        capacity *= 2;
+    }
+}
+
+/** The fewest bytes of source text that each thread converts. */
+#define PARALLEL_CHUNK_SIZE (64 * 1024)
+
+/** How far past a split point to look for a space or control character. */
+#define PARALLEL_SPLIT_WINDOW 256
+
+/**
+ * The extra bytes of source text that each chunk has room to convert, for
+ * the part of a character that the chunk before it ends with.
+ */
+#define PARALLEL_SPLIT_SLACK 64
+
+/** A slice of source text converted on its own thread. */
+struct chunk {
+    /** The conversion descriptor that converts the chunk. */
+    bib_iconv_t cd;
+
+    /** The first byte of the chunk. */
+    char const *src;
+
+    /** The amount of bytes in the chunk. */
+    size_t srclen;
+
+    /** The chunk's space in the destination buffer. */
+    char *dst;
+
+    /** The amount of bytes of space at ``dst``. */
+    size_t capacity;
+
+    /** The amount of bytes of converted text written to ``dst``. */
+    size_t used;
+
+    /** The amount of non-identical conversions in the chunk. */
+    size_t converted;
+
+    /**
+     * The amount of bytes at the end of the chunk that weren't converted,
+     * because they begin a character that continues into the next chunk.
+     */
+    size_t left;
+
+    /**
+     * `0` when the chunk was converted, or the `errno` value identifying the
+     * reason it couldn't be.
+     */
+    int error;
+
+    /** Indicates that the chunk's conversion ended after a null character. */
+    bool has_null;
+
+    /** The decoder's shift state at the start of the chunk. */
+    bib_iconv_shift_state_t entry;
+
+    /** The decoder's shift state where the chunk's conversion stopped. */
+    bib_iconv_shift_state_t exit;
+};
+
+/**
+ * Find where to split source text between two chunks, just after a space or
+ * control character near a split point.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter src: The source text.
+ * - parameter srclen: The amount of bytes in the source text.
+ * - parameter split: The offset to split the source text at.
+ * - returns: The offset to split the source text at instead.
+ *
+ * Spaces and control characters are whole characters on their own in every
+ * MARC-8 character set and in UTF-8, so splitting after one rarely splits a
+ * character. Other encodings are only split between code units. A split that
+ * lands in the middle of a character is still converted correctly, just
+ * more slowly.
+ */
+static size_t find_split(bib_iconv_t cd, char const *src, size_t srclen,
+                         size_t split) {
+    size_t const unit = (*cd->decoder_sizes)[0];
+    if (unit > 1) {
+        return split - split % unit;
+    }
+    size_t const end = (srclen - split < PARALLEL_SPLIT_WINDOW)
+                     ? srclen : split + PARALLEL_SPLIT_WINDOW;
+    for (size_t offset = split; offset < end; offset += 1) {
+        /* The escape character begins an escape sequence instead. */
+        unsigned char const c = (unsigned char)src[offset];
+        if (c <= ' ' && c != 0x1B) {
+            return offset + 1;
+        }
+    }
+    return split;
+}
+
+/**
+ * Convert a chunk of source text into its space in the destination buffer.
+ *
+ * - parameter chunk: The chunk to convert.
+ * - parameter entry: The shift state to start converting the chunk in, or
+ *   `NULL` to start in the decoder's initial state.
+ */
+static void convert_chunk(struct chunk *chunk,
+                          bib_iconv_shift_state_t const *entry) {
+    bib_iconv_t cd = chunk->cd;
+    char const *src = chunk->src;
+    size_t srclen = chunk->srclen;
+    chunk->used = 0;
+    chunk->converted = 0;
+    chunk->left = srclen;
+    chunk->has_null = false;
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    if (begin_conversion(cd, &src, &srclen) == (size_t)-1) {
+        chunk->error = errno;
+        return;
+    }
+    chunk->entry = (bib_iconv_shift_state_t){ 0 };
+    if (entry != nullptr) {
+        chunk->entry = *entry;
+        if (cd->decoder.restore != nullfun) {
+            cd->decoder.restore(&cd->decoder, entry);
+        }
+    } else if (cd->decoder.save != nullfun) {
+        cd->decoder.save(&cd->decoder, &chunk->entry);
+    }
+
+    char *dst = chunk->dst;
+    size_t dstleft = chunk->capacity;
+    size_t const result = bib_iconv(cd, &src, &srclen, &dst, &dstleft);
+    int const error = errno;
+    chunk->used = chunk->capacity - dstleft;
+    chunk->left = srclen;
+    chunk->has_null = cd->has_written_null;
+    chunk->error = 0;
+    if (result == (size_t)-1 && error != EINVAL) {
+        chunk->error = error;
+        return;
+    }
+    if (result != (size_t)-1 && !chunk->has_null && srclen > 0) {
+        /* The conversion stopped only because the buffer filled up. */
+        chunk->error = E2BIG;
+        return;
+    }
+    if (result != (size_t)-1) {
+        chunk->converted = result;
+    }
+    if (chunk->has_null) {
+        return;
+    }
+    /* The chunk's conversion stopped between two characters, either at the
+     * end of the chunk or before a character that continues past it. */
+    chunk->exit = (bib_iconv_shift_state_t){ 0 };
+    if (cd->decoder.save != nullfun) {
+        cd->decoder.save(&cd->decoder, &chunk->exit);
+    }
+}
+
+/**
+ * Convert one of the chunks of source text on an executor's thread, starting
+ * in the decoder's initial state.
+ *
+ * - parameter argument: The array of chunks.
+ * - parameter index: The index of the chunk to convert.
+ */
+static void speculate_chunk(void *argument, size_t index) {
+    struct chunk *chunks = argument;
+    convert_chunk(&chunks[index], nullptr);
+}
+
+/**
+ * Check each speculatively converted chunk against the chunk before it,
+ * converting it again when it started in the wrong state, and gather the
+ * converted text at the start of the destination buffer.
+ *
+ * - parameter chunks: The converted chunks, in order.
+ * - parameter count: The amount of chunks.
+ * - parameter buffer: The destination buffer holding every chunk's space.
+ * - parameter converted: The location to store the amount of non-identical
+ *   conversions in every chunk.
+ * - returns: The amount of bytes of converted text, or `(size_t)-1` on
+ *   failure.
+ */
+static size_t join_chunks(struct chunk *chunks, size_t count, char *buffer,
+                          size_t *restrict converted) {
+    char *dst = buffer;
+    *converted = 0;
+    for (size_t index = 0; index < count; index += 1) {
+        struct chunk *chunk = &chunks[index];
+        if (index > 0) {
+            struct chunk const *previous = &chunks[index - 1];
+            if (previous->left > 0) {
+                /* The previous chunk ends with the start of a character, so
+                 * this chunk begins with it instead. */
+                chunk->src -= previous->left;
+                chunk->srclen += previous->left;
+                convert_chunk(chunk, &previous->exit);
+            } else if (memcmp(&previous->exit, &chunk->entry,
+                              sizeof(chunk->entry)) != 0) {
+                convert_chunk(chunk, &previous->exit);
+            }
+        }
+        if (chunk->error != 0) {
+            errno = chunk->error;
+            return (size_t)-1;
+        }
+
+        bool const is_last = chunk->has_null || index + 1 == count;
+        if (is_last && !chunk->has_null && chunk->left > 0) {
+            /* The source string ends in the middle of a character. */
+            errno = EINVAL;
+            return (size_t)-1;
+        }
+        if (is_last) {
+            char *end = chunk->dst + chunk->used;
+            size_t dstleft = chunk->capacity - chunk->used;
+            size_t const r = bib_iconv(chunk->cd, nullptr, nullptr,
+                                       &end, &dstleft);
+            if (r == (size_t)-1) {
+                return r;
+            }
+            chunk->used = chunk->capacity - dstleft;
+            chunk->converted += r;
+        }
+        *converted += chunk->converted;
+        memmove(dst, chunk->dst, chunk->used);
+        dst += chunk->used;
+        if (is_last) {
+            break;
+        }
+    }
+    return (size_t)(dst - buffer);
+}
+
+size_t bib_iconv_convert_parallel(char const *restrict to,
+                                  char const *restrict from,
+                                  char const *src, size_t srclen,
+                                  char **restrict out, size_t *restrict outlen,
+                                  struct bib_iconv_executor const *executor,
+                                  struct bib_iconv_allocator const *allocator) {
+    if (src == nullptr || out == nullptr || outlen == nullptr) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    size_t count = (executor == nullptr) ? 1 : executor->width;
+    if (count > srclen / PARALLEL_CHUNK_SIZE) {
+        count = srclen / PARALLEL_CHUNK_SIZE;
+    }
+    if (count <= 1) {
+        return bib_iconv_convert_alloc(to, from, src, srclen, out, outlen,
+                                       allocator);
+    }
+    *out = nullptr;
+    *outlen = 0;
+    if (allocator == nullptr) {
+        allocator = current_allocator();
+    }
+
+    /* Allocate the chunks together with storage for their descriptors. */
+    struct chunk *chunks =
+        allocate_zeroed(allocator, count * (sizeof(struct chunk)
+                                            + BIB_ICONV_STORAGE_SIZE));
+    if (chunks == nullptr) {
+        return (size_t)-1;
+    }
+    unsigned char *storage = (unsigned char *)(chunks + count);
+
+    size_t opened = 0;
+    size_t capacity = 0;
+    size_t start = 0;
+    size_t result = 0;
+    size_t converted = 0;
+    for (; opened < count; opened += 1) {
+        bib_iconv_t cd = bib_iconv_init(storage
+                                        + opened * BIB_ICONV_STORAGE_SIZE,
+                                        BIB_ICONV_STORAGE_SIZE, to, from);
+        if (cd == (bib_iconv_t)-1) {
+            result = (size_t)-1;
+            break;
+        }
+        size_t end = srclen;
+        if (opened + 1 < count) {
+            end = find_split(cd, src, srclen, srclen / count * (opened + 1));
+        }
+        size_t const bound = bound_conversion(cd, end - start
+                                                  + PARALLEL_SPLIT_SLACK);
+        if (bound > SIZE_MAX - capacity) {
+            bib_iconv_close(cd);
+            errno = ENOMEM;
+            result = (size_t)-1;
+            break;
+        }
+        chunks[opened] = (struct chunk){
+            .cd = cd,
+            .src = src + start,
+            .srclen = end - start,
+            .capacity = bound,
+        };
+        capacity += bound;
+        start = end;
+    }
+
+    char *buffer = nullptr;
+    if (result != (size_t)-1) {
+        buffer = allocator->allocate(allocator->context, capacity);
+        if (buffer == nullptr) {
+            errno = ENOMEM;
+            result = (size_t)-1;
+        }
+    }
+    if (result != (size_t)-1) {
+        char *dst = buffer;
+        for (size_t index = 0; index < count; index += 1) {
+            chunks[index].dst = dst;
+            dst += chunks[index].capacity;
+        }
+        executor->apply(count, executor->context, chunks, speculate_chunk);
+        result = join_chunks(chunks, count, buffer, &converted);
+    }
+
+    int const error = errno;
+    for (size_t index = 0; index < opened; index += 1) {
+        bib_iconv_close(chunks[index].cd);
+    }
+    allocator->deallocate(allocator->context, chunks);
+    if (result == (size_t)-1) {
+        if (buffer != nullptr) {
+            allocator->deallocate(allocator->context, buffer);
+        }
+        if (error == E2BIG) {
+            /* A character longer than the slack between chunks didn't fit,
+             * which only the sequential conversion can handle. */
+            return bib_iconv_convert_alloc(to, from, src, srclen, out, outlen,
+                                           allocator);
+        }
+        errno = error;
+        return (size_t)-1;
+    }
+    *out = buffer;
+    *outlen = result;
+    return converted;
+}
+
+int bib_iconv_close(bib_iconv_t cd) {
+    if (cd == nullptr) {
+        return 0;
+    }
+    if (cd->encoder.deinit != nullfun) {
+        cd->encoder.deinit(&cd->encoder);
     }
     if (cd->decoder.deinit != nullfun) {
         cd->decoder.deinit(&cd->decoder);
     }
-    free(cd);
+    if (cd->is_allocated) {
+        struct bib_iconv_allocator const allocator = cd->allocator;
+        allocator.deallocate(allocator.context, cd);
+    }
+    return 0;
+}
+
+int bib_iconv_reset(bib_iconv_t cd) {
+    if (cd == nullptr) {
+        errno = EINVAL;
+        return -1;
+    }
+    /* Decoders and encoders reset their state in place when they're next
+     * initialized, at the start of the next conversion. */
+    cd->staged_start = 0;
+    cd->staged_end = 0;
+    cd->is_initialized = false;
+    return 0;
+}
+
+/** The idle descriptors in a pool that convert between two encodings. */
+struct pool_entry {
+    /** The next entry in the pool. */
+    struct pool_entry *next;
+
+    /** The pool that the entry belongs to. */
+    bib_iconv_pool_t pool;
+
+    /** The encoding that the descriptors convert text to. */
+    bib_iconv_encoding_t to;
+
+    /** The encoding that the descriptors convert text from. */
+    bib_iconv_encoding_t from;
+
+    /** How the descriptors normalize the text they convert. */
+    bib_iconv_normalization_t normalization;
+
+    /** A stack of idle descriptors, linked by ``bib_iconv_s/next_idle``. */
+    bib_iconv_t idle;
+};
+
+struct bib_iconv_pool_s {
+    /**
+     * A lock guarding ``entries`` and each entry's idle descriptors.
+     *
+     * The lock is only held to push or pop a descriptor, or to link in an
+     * entry that's already allocated, so a spin lock is enough and doesn't
+     * need a threads library.
+     */
+    atomic_flag lock;
+
+    /** The entries for each pair of encodings acquired from the pool. */
+    struct pool_entry *entries;
+
+    /** The allocator for the pool, its entries, and its descriptors. */
+    struct bib_iconv_allocator allocator;
+};
+
+/** The most times ``lock_pool`` pauses between attempts to take the lock. */
+#define POOL_MAX_BACKOFF 64
+
+/**
+ * Hint to the processor that the thread is waiting in a spin loop, which lets
+ * it save power and yield to a sibling hardware thread.
+ */
+static inline void spin_pause(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static void lock_pool(bib_iconv_pool_t pool) {
+    /* Back off exponentially while the lock is held, so that waiting threads
+     * don't keep fighting over the lock's cache line. */
+    unsigned int backoff = 1;
+    while (atomic_flag_test_and_set_explicit(&pool->lock,
+                                             memory_order_acquire)) {
+        for (unsigned int spin = 0; spin < backoff; spin += 1) {
+            spin_pause();
+        }
+        if (backoff < POOL_MAX_BACKOFF) {
+            backoff *= 2;
+        }
+    }
+}
+
+static void unlock_pool(bib_iconv_pool_t pool) {
+    atomic_flag_clear_explicit(&pool->lock, memory_order_release);
+}
+
+/**
+ * Find the entry in a pool for a pair of encodings. The pool must be locked.
+ *
+ * - returns: The pool entry, or `NULL` when it doesn't exist.
+ */
+static struct pool_entry *
+find_entry(bib_iconv_pool_t pool, bib_iconv_encoding_t to,
+           bib_iconv_encoding_t from, bib_iconv_normalization_t normalization) {
+    for (struct pool_entry *entry = pool->entries; entry != nullptr;
+         entry = entry->next) {
+        if (entry->to == to && entry->from == from
+            && entry->normalization == normalization) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Find the entry in a pool for a pair of encodings, adding it when it doesn't
+ * exist yet. The pool must not be locked.
+ *
+ * - returns: The pool entry, or `NULL` when it can't be allocated.
+ *
+ * The new entry is allocated before taking the lock, so that the pool's
+ * allocator never runs while the lock is held. When another thread adds the
+ * same entry first, the new one is deallocated.
+ */
+static struct pool_entry *
+add_entry(bib_iconv_pool_t pool, bib_iconv_encoding_t to,
+          bib_iconv_encoding_t from, bib_iconv_normalization_t normalization) {
+    struct pool_entry *added = allocate_zeroed(&pool->allocator,
+                                               sizeof(struct pool_entry));
+    if (added == nullptr) {
+        return nullptr;
+    }
+    added->to = to;
+    added->from = from;
+    added->normalization = normalization;
+    added->pool = pool;
+
+    lock_pool(pool);
+    struct pool_entry *entry = find_entry(pool, to, from, normalization);
+    if (entry == nullptr) {
+        added->next = pool->entries;
+        pool->entries = added;
+        entry = added;
+    }
+    unlock_pool(pool);
+    if (entry != added) {
+        pool->allocator.deallocate(pool->allocator.context, added);
+    }
+    return entry;
+}
+
+bib_iconv_pool_t bib_iconv_pool_create(void) {
+    struct bib_iconv_allocator const *allocator = current_allocator();
+    bib_iconv_pool_t pool = allocate_zeroed(allocator,
+                                            sizeof(struct bib_iconv_pool_s));
+    if (pool == nullptr) {
+        return nullptr;
+    }
+    atomic_flag_clear(&pool->lock);
+    pool->allocator = *allocator;
+    return pool;
+}
+
+void bib_iconv_pool_destroy(bib_iconv_pool_t pool) {
+    if (pool == nullptr) {
+        return;
+    }
+    struct pool_entry *entry = pool->entries;
+    while (entry != nullptr) {
+        struct pool_entry *next = entry->next;
+        bib_iconv_t cd = entry->idle;
+        while (cd != nullptr) {
+            bib_iconv_t next_idle = cd->next_idle;
+            bib_iconv_close(cd);
+            cd = next_idle;
+        }
+        pool->allocator.deallocate(pool->allocator.context, entry);
+        entry = next;
+    }
+    struct bib_iconv_allocator const allocator = pool->allocator;
+    allocator.deallocate(allocator.context, pool);
+}
+
+bib_iconv_t bib_iconv_pool_acquire(bib_iconv_pool_t pool,
+                                   char const *restrict to,
+                                   char const *restrict from) {
+    if (pool == nullptr) {
+        errno = EINVAL;
+        return (bib_iconv_t)-1;
+    }
+    /* Key the pool's entries on the encodings that the names identify, so
+     * that different names for the same encodings share idle descriptors. */
+    bib_iconv_normalization_t normalization;
+    bib_iconv_encoding_t const target = target_encoding(to, &normalization);
+    bib_iconv_encoding_t const source = bib_iconv_encoding(from);
+
+    lock_pool(pool);
+    struct pool_entry *entry = find_entry(pool, target, source,
+                                          normalization);
+    bib_iconv_t cd = nullptr;
+    if (entry != nullptr && entry->idle != nullptr) {
+        cd = entry->idle;
+        entry->idle = cd->next_idle;
+        cd->next_idle = nullptr;
+    }
+    unlock_pool(pool);
+    if (cd != nullptr) {
+        return cd;
+    }
+
+    /* There's no idle descriptor to reuse, so open a new one outside of the
+     * lock. It joins the pool's idle descriptors when it's released. Entries
+     * are only added for encodings that can be opened. */
+    cd = open_descriptor(target, source, normalization, &pool->allocator);
+    if (cd == (bib_iconv_t)-1) {
+        return cd;
+    }
+    if (entry == nullptr) {
+        entry = add_entry(pool, target, source, normalization);
+        if (entry == nullptr) {
+            bib_iconv_close(cd);
+            return (bib_iconv_t)-1;
+        }
+    }
+    cd->pool_entry = entry;
+    return cd;
+}
+
+int bib_iconv_pool_release(bib_iconv_pool_t pool, bib_iconv_t cd) {
+    if (pool == nullptr || cd == nullptr || cd == (bib_iconv_t)-1
+        || cd->pool_entry == nullptr || cd->pool_entry->pool != pool) {
+        errno = EINVAL;
+        return -1;
+    }
+    bib_iconv_reset(cd);
+    struct pool_entry *entry = cd->pool_entry;
+    lock_pool(pool);
+    cd->next_idle = entry->idle;
+    entry->idle = cd;
+    unlock_pool(pool);
     return 0;
 }
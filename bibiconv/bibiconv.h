@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +36,64 @@ extern const unsigned char bibiconvVersionString[];
  */
 typedef struct bib_iconv_s *bib_iconv_t;
 
+/**
+ * Identifies a character encoding supported by the bibiconv library.
+ */
+typedef enum bib_iconv_encoding {
+    /** An encoding name that the bibiconv library doesn't recognize. */
+    BIB_ICONV_UNKNOWN = 0,
+
+    /** MARC-8, also known as ANSEL or ANSI/NISO Z39.47. */
+    BIB_ICONV_MARC8,
+
+    /** UTF-8. */
+    BIB_ICONV_UTF8,
+
+    /** UTF-16, also known as UCS-2, in the host's byte order. */
+    BIB_ICONV_UTF16,
+
+    /** UTF-32, also known as UCS-4, in the host's byte order. */
+    BIB_ICONV_UTF32,
+} bib_iconv_encoding_t;
+
+/**
+ * Looks up the character encoding identified by a name.
+ *
+ * - parameter name: The name of a character encoding.
+ * - returns: The identified character encoding, or ``BIB_ICONV_UNKNOWN``
+ *   when the name isn't recognized. A `NULL` or empty name identifies UTF-8.
+ *
+ * Names are matched without regard to case, or to `'-'`, `'_'`, `'.'`, `'/'`,
+ * and `' '` characters, so `"UTF-8"`, `"utf8"`, and `"UTF_8"` are all the same
+ * encoding. Recognized names include `"MARC-8"`, `"ANSEL"`, `"Z39.47"`,
+ * `"UTF-8"`, `"char"`, `"UTF-16"`, `"UCS-2"`, `"UTF-32"`, `"UCS-4"`,
+ * `"wchar_t"`, and a few others. Each name is looked up with a single hash
+ * table probe.
+ */
+bib_iconv_encoding_t bib_iconv_encoding(char const *name);
+
+/**
+ * A set of functions used to allocate memory for conversion descriptors and
+ * converted text.
+ *
+ * Each function is given the allocator's ``context`` as its first argument,
+ * which lets the functions allocate from something like a per-request arena.
+ */
+struct bib_iconv_allocator {
+    /**
+     * Allocate `size` bytes of memory, and return `NULL` on failure.
+     */
+    void *(*allocate)(void *context, size_t size);
+
+    /**
+     * Deallocate the memory at `pointer`.
+     */
+    void (*deallocate)(void *context, void *pointer);
+
+    /** The value passed as the first argument to each function. */
+    void *context;
+};
+
 /**
  * Creates a descriptor used to convert from one character encoding to another.
  *
@@ -57,19 +116,233 @@ typedef struct bib_iconv_s *bib_iconv_t;
  * can convert between the different Unicode formats, but cannot yet convert
  * from Unicode to MARC-8.
  *
+ * Unicode source text is checked the same way whichever encoding it's
+ * converted to. The conversion stops with `EILSEQ` at the first byte of an
+ * ill-formed sequence, such as an overlong or surrogate UTF-8 sequence, or an
+ * unpaired UTF-16 surrogate. Converting a Unicode format to itself copies
+ * well-formed text as it is.
+ *
+ * Add `"//CANONICAL"` to the end of `to`, as in `"UTF-8//CANONICAL"`, to sort
+ * the diacritics that modify each character decoded from MARC-8 into canonical
+ * order by their canonical combining classes, so that text that looks the
+ * same is always decoded into the same characters. Add `"//NFC"` instead to
+ * also compose each character with its diacritics into precomposed
+ * characters, as in Unicode Normalization Form C. Diacritics without a
+ * precomposed form are left as combining characters. These options are only
+ * supported when `from` is MARC-8.
+ *
  * Valid character encoding values include: "MARC-8", "UTF-8", "UTF-16",
- * "UTF-32", and variations of those values as lowercase and without the dash.
+ * "UTF-32", and the other names recognized by ``bib_iconv_encoding``.
  */
 bib_iconv_t bib_iconv_open(char const *restrict to, char const *restrict from);
 
+/**
+ * Creates a descriptor used to convert from one character encoding to another,
+ * identifying the encodings without parsing their names.
+ *
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - returns: A conversion descriptor to use when converting text between
+ *   character encodings. Returns `(bib_iconv_t)-1` when there's an error
+ *   opening a descriptor.
+ *
+ * ## Errors
+ *
+ * - term **`EINVAL`**: Either `to` or `from` isn't a supported character
+ *   encoding, or the bibiconv library can't convert text to `to`.
+ * - term **`ENOMEM`**: The function ran out of heap memory when attempting to
+ *   allocate space for the descriptor and its internal data structures.
+ *
+ * ## Discussion
+ *
+ * Look up encodings once with ``bib_iconv_encoding`` when opening many
+ * descriptors for the same encodings.
+ */
+bib_iconv_t bib_iconv_open_id(bib_iconv_encoding_t to,
+                              bib_iconv_encoding_t from);
+
+/**
+ * Creates a descriptor used to convert from one character encoding to another,
+ * allocating it with the given allocator.
+ *
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - parameter allocator: The allocator to allocate the descriptor with, or
+ *   `NULL` to use the global allocator. The allocator's functions are copied
+ *   into the descriptor, and are used again to deallocate it when it's closed.
+ * - returns: A conversion descriptor to use when converting text between
+ *   character encodings. Returns `(bib_iconv_t)-1` when there's an error
+ *   opening a descriptor.
+ *
+ * ## Errors
+ *
+ * - term **`EINVAL`**: Either `to` or `from` don't describe a valid character
+ *   encoding supported by the bibiconv library.
+ * - term **`ENOMEM`**: The allocator ran out of memory when attempting to
+ *   allocate space for the descriptor.
+ *
+ * ## Discussion
+ *
+ * A descriptor and all of its conversion state are allocated at once, so this
+ * is the only allocation made for the descriptor. ``bib_iconv_open`` is the
+ * same as calling this function with a `NULL` allocator.
+ */
+bib_iconv_t bib_iconv_open_allocator(char const *restrict to,
+                                     char const *restrict from,
+                                     struct bib_iconv_allocator const
+                                         *allocator);
+
+/**
+ * Sets the global allocator, used for all memory that isn't allocated with an
+ * allocator of its own.
+ *
+ * - parameter allocator: The new global allocator, or `NULL` to go back to
+ *   using `malloc` and `free`. The allocator must stay valid until another one
+ *   replaces it and everything it allocated is deallocated.
+ *
+ * The global allocator is used by ``bib_iconv_open``, by descriptor pools
+ * created with ``bib_iconv_pool_create``, and by ``bib_iconv_convert_alloc``
+ * when it's given a `NULL` allocator. Descriptors and pools keep using the
+ * allocator they were created with, even after the global allocator changes.
+ */
+void bib_iconv_set_allocator(struct bib_iconv_allocator const *allocator);
+
+/**
+ * The amount of bytes of storage that ``bib_iconv_init`` needs for any
+ * conversion descriptor.
+ */
+#define BIB_ICONV_STORAGE_SIZE 2048
+
+/**
+ * Creates a descriptor used to convert from one character encoding to another
+ * in caller-provided storage, without allocating any memory.
+ *
+ * - parameter storage: The memory to create the descriptor in. It doesn't
+ *   need any particular alignment.
+ * - parameter size: The amount of bytes of memory at `storage`, which is
+ *   always enough when it's at least ``BIB_ICONV_STORAGE_SIZE``.
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - returns: A conversion descriptor to use when converting text between
+ *   character encodings. Returns `(bib_iconv_t)-1` when there's an error
+ *   creating a descriptor.
+ *
+ * ## Errors
+ *
+ * - term **`EINVAL`**: Either `to` or `from` don't describe a valid character
+ *   encoding supported by the bibiconv library, `storage` is `NULL`, or
+ *   `size` is too small for the descriptor.
+ *
+ * ## Discussion
+ *
+ * This creates the same descriptor as ``bib_iconv_open``, but keeps it and all
+ * of its conversion state in `storage`, which can be on the stack or inside
+ * another structure. The descriptor must still be closed with
+ * ``bib_iconv_close`` before `storage` is reused or deallocated, but closing
+ * it leaves `storage` for the caller to deallocate.
+ *
+ * ```c
+ * unsigned char storage[BIB_ICONV_STORAGE_SIZE];
+ * bib_iconv_t cd = bib_iconv_init(storage, sizeof(storage), "UTF-8", "MARC-8");
+ * ```
+ */
+bib_iconv_t bib_iconv_init(void *storage, size_t size,
+                           char const *restrict to, char const *restrict from);
+
 /**
  * Cleans up and destroys a conversion descriptor.
  *
  * - parameter cd: The conversion descriptor to close.
  * - returns: `0` when the conversion descriptor is closed and deallocated.
+ *
+ * Descriptors created with ``bib_iconv_init`` are closed without deallocating
+ * the storage they were created in.
  */
 int bib_iconv_close(bib_iconv_t cd);
 
+/**
+ * Returns a conversion descriptor to the state it was in when it was opened.
+ *
+ * - parameter cd: The conversion descriptor to reset.
+ * - returns: `0` when the conversion descriptor is reset, and `-1` with
+ *   `errno` set to `EINVAL` when `cd` is `NULL`.
+ *
+ * Resetting discards any pending characters and conversion state without
+ * writing them anywhere, just like flushing with a `NULL` destination. The
+ * next conversion starts with the initial MARC-8 working set, and nothing is
+ * deallocated, so a descriptor can be reset and reused for every record.
+ */
+int bib_iconv_reset(bib_iconv_t cd);
+
+/**
+ * A thread-safe pool of conversion descriptors that can be reused.
+ */
+typedef struct bib_iconv_pool_s *bib_iconv_pool_t;
+
+/**
+ * Creates an empty pool of conversion descriptors.
+ *
+ * - returns: A new pool, or `NULL` with `errno` set to `ENOMEM` when there
+ *   isn't enough memory to create one.
+ *
+ * The pool and all of its descriptors are allocated with the global allocator
+ * at the time the pool is created.
+ */
+bib_iconv_pool_t bib_iconv_pool_create(void);
+
+/**
+ * Closes all of the idle conversion descriptors in a pool, and destroys it.
+ *
+ * - parameter pool: The pool to destroy.
+ *
+ * Release every descriptor acquired from the pool before destroying it.
+ */
+void bib_iconv_pool_destroy(bib_iconv_pool_t pool);
+
+/**
+ * Takes a conversion descriptor out of a pool, opening a new one when the pool
+ * doesn't have an idle descriptor for the given encodings.
+ *
+ * - parameter pool: The pool to take the descriptor from.
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - returns: A conversion descriptor in its initial state, or
+ *   `(bib_iconv_t)-1` when there's an error opening a descriptor.
+ *
+ * ## Errors
+ *
+ * - term **`EINVAL`**: Either `pool` is `NULL`, or `to` or `from` don't
+ *   describe a valid character encoding supported by the bibiconv library.
+ * - term **`ENOMEM`**: The function ran out of heap memory when attempting to
+ *   allocate space for the descriptor or the pool.
+ *
+ * ## Discussion
+ *
+ * Idle descriptors are kept for each pair of encodings that `to` and `from`
+ * identify, along with the option after `"//"` in `to`, so different names
+ * for the same encodings share idle descriptors. Reusing a descriptor skips
+ * setting one up and allocating memory.
+ *
+ * Give the descriptor back with ``bib_iconv_pool_release`` once the
+ * conversion is done, instead of closing it. Any thread may acquire and release
+ * descriptors from the same pool, but each descriptor should only be used by
+ * one thread at a time.
+ */
+bib_iconv_t bib_iconv_pool_acquire(bib_iconv_pool_t pool,
+                                   char const *restrict to,
+                                   char const *restrict from);
+
+/**
+ * Resets a conversion descriptor, and puts it back into the pool it was
+ * acquired from.
+ *
+ * - parameter pool: The pool that the descriptor was acquired from.
+ * - parameter cd: The conversion descriptor to release.
+ * - returns: `0` when the descriptor is released, and `-1` with `errno` set
+ *   to `EINVAL` when `cd` wasn't acquired from `pool`.
+ */
+int bib_iconv_pool_release(bib_iconv_pool_t pool, bib_iconv_t cd);
+
 /**
  * Converts text in a given buffer from one encoding to another.
  *
@@ -99,11 +372,14 @@ int bib_iconv_close(bib_iconv_t cd);
  * When this function returns `(size_t)-1`, `errno` is set to a value
  * identifying the reason for the conversion failure.
  *
- * - term **`EINVAL`**: Either `cd`, `dst`, `*dst`, or `dstleft` are `NULL`.
+ * - term **`EINVAL`**: Either `cd`, `dst`, `*dst`, or `dstleft` are `NULL`, or
+ *   the source buffer ends in the middle of a character. The incomplete
+ *   character is left in the source buffer, so that it can be converted along
+ *   with the rest of its bytes.
  * - term **`E2BIG`**: The conversion ran out of space in the destination
- *   buffer. Allocate more space for the destination, then call `bib_iconv`
- *   again with the new values of `src` and `srcleft` to continue the
- *   conversion.
+ *   buffer. Make more space available in the destination, then call
+ *   `bib_iconv` again with the new values of `src` and `srcleft` to continue
+ *   the conversion.
  * - term **`EILSEQ`**: An invalid character sequence was encountered in the
  *   source buffer. Handle the invalid character sequence by correcting it or
  *   skipping over it, then call `bib_iconv` again with the new values of `src`
@@ -123,6 +399,19 @@ int bib_iconv_close(bib_iconv_t cd);
  * progress. The function will then return `(size_t)-1` and set `errno` to
  * `EILSEQ` for the invalid sequence, or `E2BIG` for running out of space.
  *
+ * A destination buffer with room for even a single byte is always filled, so
+ * every call makes progress. When a character doesn't fit, the conversion
+ * descriptor writes as many of its bytes as fit and stages the rest, which are
+ * written at the start of the next call. The destination buffers from
+ * consecutive calls hold the same bytes as one large buffer would, but a
+ * character's code units may be split between them.
+ *
+ * Some characters are held by the conversion descriptor after reading them,
+ * such as MARC-8 combining characters that come before the character they
+ * modify. When the destination buffer fills up after the last character in the
+ * source buffer is read, call `bib_iconv` with an empty source buffer to write
+ * the rest of them.
+ *
  * To finalize conversion, always make sure to call `bib_iconv` with a `NULL`
  * `src` and `srcleft` to flush out any remaining state from the conversion
  * descriptor. This allows the conversion descriptor to write any pending
@@ -177,6 +466,401 @@ size_t bib_iconv(bib_iconv_t cd,
                  char const **restrict src, size_t *restrict srcleft,
                  char **restrict dst, size_t *restrict dstleft);
 
+/**
+ * Converts text from one encoding to another, reading from a list of source
+ * buffers and writing to a list of destination buffers.
+ *
+ * - parameter cd: The conversion descriptor used to convert the given text.
+ * - parameter in: The source buffers to read encoded text from, in order.
+ *   Each buffer's `iov_base` and `iov_len` are updated to reflect the bytes
+ *   that were read from it.
+ * - parameter nin: The amount of buffers in `in`.
+ * - parameter out: The destination buffers to write converted text to, in
+ *   order. Each buffer's `iov_base` and `iov_len` are updated to reflect the
+ *   bytes that were written to it.
+ * - parameter nout: The amount of buffers in `out`.
+ * - returns: `0` upon a successful conversion, or `(size_t)-1` on error. A
+ *   positive non-zero value identifies the number of non-identical conversions,
+ *   just like ``bib_iconv``.
+ *
+ * ## Errors
+ *
+ * When this function returns `(size_t)-1`, `errno` is set to a value
+ * identifying the reason for the conversion failure.
+ *
+ * - term **`EINVAL`**: Either `cd` is invalid, `in` or `out` are `NULL` while
+ *   `nin` or `nout` are positive, or the last source buffer ends in the middle
+ *   of a character.
+ * - term **`E2BIG`**: There isn't enough room left in the destination buffers.
+ *   Call `bib_iconv_iov` again with more destination buffers to continue the
+ *   conversion.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   source buffers, at the start of the first source buffer with bytes left.
+ * - term **`ENOMEM`**: The function ran out of heap memory when attempting to
+ *   allocate space for its internal data structures.
+ *
+ * ## Discussion
+ *
+ * This converts the source buffers as though they were one contiguous string,
+ * without copying them into a single buffer first. The escape sequences that
+ * change MARC-8 character sets carry over from one source buffer into the
+ * next, and characters that are split between two source buffers are read
+ * whole. Converted text fills each destination buffer before moving on to the
+ * next one, so a character's code units may also be split between two
+ * destination buffers.
+ *
+ * Like ``bib_iconv``, the conversion ends once every source buffer is empty,
+ * or after converting a null character. To finalize conversion, call
+ * `bib_iconv_iov` with a `NULL` `in` to flush any remaining state from the
+ * conversion descriptor into the destination buffers.
+ */
+size_t bib_iconv_iov(bib_iconv_t cd, struct iovec *in, int nin,
+                     struct iovec *out, int nout);
+
+/**
+ * A span of bytes, such as one of the strings converted by
+ * ``bib_iconv_batch``.
+ */
+struct bib_span {
+    /** The first byte in the span. */
+    char const *data;
+
+    /** The amount of bytes in the span. */
+    size_t length;
+};
+
+/**
+ * Converts many independent strings from one encoding to another into a single
+ * shared destination buffer.
+ *
+ * - parameter cd: The conversion descriptor used to convert the strings.
+ * - parameter n: The amount of strings to convert.
+ * - parameter in: The `n` source strings to convert.
+ * - parameter out: The location to store `n` spans of the destination buffer,
+ *   one holding the converted text of each source string.
+ * - parameter status: The location to store `n` values, one for each source
+ *   string: `0` when it was converted, or the `errno` value identifying the
+ *   reason it couldn't be converted.
+ * - parameter dst: The destination buffer to write converted text to.
+ * - parameter dstlen: The amount of bytes in the destination buffer.
+ * - returns: The amount of source strings that were converted or failed to
+ *   convert, which is less than `n` when the destination buffer ran out of
+ *   space, or `(size_t)-1` on error.
+ *
+ * ## Errors
+ *
+ * When this function returns `(size_t)-1`, `errno` is set to a value
+ * identifying the reason for the failure.
+ *
+ * - term **`EINVAL`**: Either `cd` is `NULL`, or `in`, `out`, `status`, or
+ *   `dst` are `NULL` while `n` is positive.
+ *
+ * Each source string's own status is one of the following values:
+ *
+ * - term **`0`**: The string was converted.
+ * - term **`EINVAL`**: The string ends in the middle of a character.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   string.
+ * - term **`E2BIG`**: There isn't enough room left in the destination buffer
+ *   for the converted string. This is only the status of the last string that
+ *   the function returns.
+ *
+ * ## Discussion
+ *
+ * Each string is converted from the initial state of the conversion
+ * descriptor, so that escape sequences in one MARC-8 string don't affect the
+ * next one, and is written to the destination buffer right after the previous
+ * one. Like ``bib_iconv``, a conversion ends at the end of a string, or after
+ * converting a null character.
+ *
+ * A string that fails to convert gets an empty span, and the strings after it
+ * are still converted. When the destination buffer runs out of space, the
+ * function returns the index of the string that didn't fit, which can be
+ * converted along with the rest of the strings into another buffer.
+ *
+ * Converting many short strings in a single call avoids the cost of checking
+ * arguments, flushing, and resetting the descriptor with separate calls to
+ * ``bib_iconv`` for each string. The descriptor is left ready to start a new
+ * conversion.
+ */
+size_t bib_iconv_batch(bib_iconv_t cd, size_t n,
+                       struct bib_span const *restrict in,
+                       struct bib_span *restrict out, int *restrict status,
+                       char *dst, size_t dstlen);
+
+/**
+ * Measures the exact size of text converted from one encoding to another,
+ * without writing the converted text anywhere.
+ *
+ * - parameter cd: The conversion descriptor used to measure the given string.
+ * - parameter src: The source string to measure.
+ * - parameter srclen: The amount of bytes in the source string.
+ * - parameter dstlen: The location to store the amount of bytes that
+ *   ``bib_iconv`` writes when converting the source string from the start of
+ *   a conversion. When the measurement fails, this is set to the amount of
+ *   bytes written before the failing character.
+ * - returns: `0` upon a successful measurement, or `(size_t)-1` on error.
+ *
+ * ## Errors
+ *
+ * When this function returns `(size_t)-1`, `errno` is set to a value
+ * identifying the reason for the measurement failure.
+ *
+ * - term **`EINVAL`**: Either `cd`, `src`, or `dstlen` are `NULL`, or the
+ *   source string ends in the middle of a character.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   source string.
+ * - term **`ENOMEM`**: The function ran out of heap memory when attempting to
+ *   allocate space for its internal data structures.
+ *
+ * ## Discussion
+ *
+ * Measure a string to allocate a destination buffer of exactly the right size
+ * before converting it, instead of retrying the conversion with larger buffers
+ * after `E2BIG` errors.
+ *
+ * The measurement reads the source string with the same decoder as
+ * ``bib_iconv``, so the measured size always matches the converted text. Like
+ * ``bib_iconv``, it ends at the end of the source string, or after measuring a
+ * null character. When converting from MARC-8, runs of ASCII characters are
+ * counted as a whole.
+ *
+ * Measuring resets the conversion descriptor, discarding any state from a
+ * previous conversion, just like flushing it. The descriptor is left ready to
+ * start the conversion of the measured string.
+ */
+size_t bib_iconv_measure(bib_iconv_t cd, char const *src, size_t srclen,
+                         size_t *dstlen);
+
+/**
+ * A sparse index of the points in a long source text where a conversion can
+ * resume, created with ``bib_iconv_index_create``.
+ */
+typedef struct bib_iconv_index_s *bib_iconv_index_t;
+
+/**
+ * Decodes a source text from start to end, recording checkpoints where a
+ * conversion can later resume with ``bib_iconv_seek``.
+ *
+ * - parameter cd: The conversion descriptor used to decode the source text.
+ * - parameter src: The source text to index.
+ * - parameter srclen: The amount of bytes in the source text.
+ * - parameter interval: The amount of bytes of source text between
+ *   checkpoints.
+ * - returns: A new index, or `NULL` on error.
+ *
+ * ## Errors
+ *
+ * When this function returns `NULL`, `errno` is set to a value identifying
+ * the reason for the failure.
+ *
+ * - term **`EINVAL`**: Either `cd` or `src` are `NULL`, `interval` is `0`, or
+ *   the source text ends in the middle of a character.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   source text.
+ * - term **`ENOMEM`**: The function ran out of heap memory when attempting to
+ *   allocate space for the index.
+ *
+ * ## Discussion
+ *
+ * Escape sequences in MARC-8 text change the character sets of everything
+ * after them, so converting a slice from the middle of a long text normally
+ * means decoding all of the text before it. An index records the character
+ * sets in effect at the last character boundary at or before every
+ * `interval` bytes, so that seeking to any offset only decodes the text after
+ * the nearest checkpoint before it. When a character spans the end of an
+ * interval, its checkpoint is at the start of that character.
+ *
+ * Like ``bib_iconv_measure``, indexing reads the source text without writing
+ * the converted text anywhere, and ends after a null character. The index is
+ * allocated with the global allocator, and doesn't keep a reference to the
+ * descriptor or the source text. It can be shared by any descriptors that
+ * convert from the same encoding. Indexing resets the conversion descriptor,
+ * leaving it ready to start a new conversion.
+ */
+bib_iconv_index_t bib_iconv_index_create(bib_iconv_t cd, char const *src,
+                                         size_t srclen, size_t interval);
+
+/**
+ * Destroys an index created with ``bib_iconv_index_create``.
+ *
+ * - parameter index: The index to destroy.
+ */
+void bib_iconv_index_destroy(bib_iconv_index_t index);
+
+/**
+ * Prepares a conversion descriptor to convert indexed source text starting
+ * from an offset in the middle of it.
+ *
+ * - parameter cd: The conversion descriptor to prepare.
+ * - parameter index: The index of the source text.
+ * - parameter src: The start of the indexed source text.
+ * - parameter offset: The offset from `src` of the first character to
+ *   convert.
+ * - returns: `0` when the descriptor is ready to convert the source text at
+ *   `src + offset`, or `-1` on error.
+ *
+ * ## Errors
+ *
+ * When this function returns `-1`, `errno` is set to a value identifying the
+ * reason for the failure.
+ *
+ * - term **`EINVAL`**: Either `cd`, `index`, or `src` are `NULL`, `offset` is
+ *   past the end of the indexed text or isn't at the start of a character, or
+ *   `cd` converts from a different encoding than the one indexed.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered between
+ *   the nearest checkpoint and `offset`.
+ *
+ * ## Discussion
+ *
+ * The descriptor is reset, the character sets recorded at the nearest
+ * checkpoint before `offset` are restored, and the source text between the
+ * checkpoint and `offset` is decoded without writing it anywhere. Seeking
+ * takes time proportional to the index's interval instead of to `offset`.
+ *
+ * Afterwards, call ``bib_iconv`` with `src + offset` to convert the source
+ * text from that point on, exactly as it's converted when converting the
+ * whole text from the start. The descriptor's character sets carry over
+ * into the following calls, so convert the slice in order until flushing or
+ * resetting the descriptor.
+ */
+int bib_iconv_seek(bib_iconv_t cd, bib_iconv_index_t index,
+                   char const *src, size_t offset);
+
+/**
+ * Converts text from one encoding to another into a newly allocated buffer.
+ *
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - parameter src: The source string to convert.
+ * - parameter srclen: The amount of bytes in the source string.
+ * - parameter out: The location to store the allocated buffer containing the
+ *   converted text. This is set to `NULL` when there's nothing to convert, or
+ *   when the conversion fails.
+ * - parameter outlen: The location to store the amount of bytes of converted
+ *   text in the allocated buffer.
+ * - parameter allocator: The allocator to allocate the buffer with, or `NULL`
+ *   to use the global allocator.
+ * - returns: `0` upon a successful conversion, or `(size_t)-1` on error. A
+ *   positive non-zero value identifies the number of non-identical conversions,
+ *   just like ``bib_iconv``.
+ *
+ * ## Errors
+ *
+ * When this function returns `(size_t)-1`, `errno` is set to a value
+ * identifying the reason for the conversion failure.
+ *
+ * - term **`EINVAL`**: Either `to` or `from` don't describe a valid character
+ *   encoding, either `src`, `out`, or `outlen` are `NULL`, or the source
+ *   string ends in the middle of a character.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   source string.
+ * - term **`ENOMEM`**: The allocator or the function ran out of memory.
+ *
+ * ## Discussion
+ *
+ * This creates a conversion descriptor on the stack, converts the whole source
+ * string, and closes the descriptor, without having to manage the destination
+ * buffer. Like ``bib_iconv``, the conversion ends at the end of the source
+ * string, or after converting a null character. The converted text isn't null
+ * terminated unless it ends with a converted null character.
+ *
+ * The buffer starts out large enough for the longest possible conversion of
+ * the source string, such as 3 bytes of UTF-8 for every byte of MARC-8, so the
+ * source string is converted in a single pass. The buffer may be larger than
+ * the converted text. Release it with the allocator's `deallocate` function.
+ */
+size_t bib_iconv_convert_alloc(char const *restrict to,
+                               char const *restrict from,
+                               char const *src, size_t srclen,
+                               char **restrict out, size_t *restrict outlen,
+                               struct bib_iconv_allocator const *allocator);
+
+/**
+ * A set of threads that ``bib_iconv_convert_parallel`` runs its work on.
+ *
+ * The bibiconv library doesn't start any threads of its own, so that it
+ * doesn't depend on a threads library. Provide ``apply`` with whatever
+ * runs work in parallel in your program, such as a thread pool or a Grand
+ * Central Dispatch queue.
+ */
+struct bib_iconv_executor {
+    /**
+     * Call `work(argument, index)` once for every `index` from `0` up to
+     * `count`, possibly at the same time on different threads, and return
+     * once every call has returned.
+     *
+     * This has the same parameters as `dispatch_apply_f`, with the executor's
+     * ``context`` in place of the dispatch queue.
+     */
+    void (*apply)(size_t count, void *context, void *argument,
+                  void (*work)(void *argument, size_t index));
+
+    /** The value passed as the second argument to ``apply``. */
+    void *context;
+
+    /** The amount of threads that ``apply`` runs work on at the same time. */
+    size_t width;
+};
+
+/**
+ * Converts a large source text from one encoding to another into a newly
+ * allocated buffer, on several threads at once.
+ *
+ * - parameter to: The character encoding to convert text to.
+ * - parameter from: The character encoding to convert text from.
+ * - parameter src: The source string to convert.
+ * - parameter srclen: The amount of bytes in the source string.
+ * - parameter out: The location to store the allocated buffer containing the
+ *   converted text. This is set to `NULL` when there's nothing to convert, or
+ *   when the conversion fails.
+ * - parameter outlen: The location to store the amount of bytes of converted
+ *   text in the allocated buffer.
+ * - parameter executor: The threads to convert the source string on, or
+ *   `NULL` to convert it on the calling thread.
+ * - parameter allocator: The allocator to allocate the buffer with, or `NULL`
+ *   to use the global allocator.
+ * - returns: `0` upon a successful conversion, or `(size_t)-1` on error. A
+ *   positive non-zero value identifies the number of non-identical conversions,
+ *   just like ``bib_iconv_convert_alloc``.
+ *
+ * ## Errors
+ *
+ * When this function returns `(size_t)-1`, `errno` is set to a value
+ * identifying the reason for the conversion failure.
+ *
+ * - term **`EINVAL`**: Either `to` or `from` don't describe a valid character
+ *   encoding, either `src`, `out`, or `outlen` are `NULL`, or the source
+ *   string ends in the middle of a character.
+ * - term **`EILSEQ`**: An invalid character sequence was encountered in the
+ *   source string.
+ * - term **`ENOMEM`**: The allocator or the function ran out of memory.
+ *
+ * ## Discussion
+ *
+ * The converted text is always the same as ``bib_iconv_convert_alloc``
+ * converts, including the errors. The source string is split into about one
+ * chunk per thread, after a space or control character near each split
+ * point, and every chunk is converted at the same time as though it started
+ * a conversion, in the initial MARC-8 character sets.
+ *
+ * Once the chunks are converted, each one is checked in order against the
+ * chunk before it. A chunk is converted again when the chunk before it ended
+ * in different character sets, or didn't end between two characters. Text
+ * that seldom changes character sets, or that changes back to the initial
+ * ones, is only converted once, so the conversion scales with the amount of
+ * threads.
+ *
+ * Strings shorter than a few chunks of 64 KiB are converted on the calling
+ * thread with ``bib_iconv_convert_alloc``.
+ */
+size_t bib_iconv_convert_parallel(char const *restrict to,
+                                  char const *restrict from,
+                                  char const *src, size_t srclen,
+                                  char **restrict out, size_t *restrict outlen,
+                                  struct bib_iconv_executor const *executor,
+                                  struct bib_iconv_allocator const *allocator);
+
 #ifdef __cplusplus
 #ifdef __BIB_DEFINED_RESTRICT
 #undef restrict
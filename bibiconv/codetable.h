@@ -6,6 +6,7 @@
 #ifndef BIBICONV_CODETABLE_H
 #define BIBICONV_CODETABLE_H
 
+#include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
 #include <bibiconv/cfeatures.h>
@@ -460,6 +461,28 @@ typedef struct bib_iconv_code_span {
     struct bib_iconv_code_path const *graphic_map;
 } bib_iconv_code_span_t;
 
+/**
+ * An index of the assigned code units in a code span's graphic map.
+ *
+ * A ``bib_iconv_code_span/graphic_map`` array is sorted by code unit, so the
+ * amount of assigned code units ordered before a given code unit is also the
+ * position of that code unit's entry in the array. This structure keeps a bit
+ * for each code unit from `0x20` to `0x7F`, so that the position can be found
+ * by counting the set bits before it, instead of iterating over the array.
+ *
+ * This turns the O(n) lookup of a code unit in a graphic map into a fixed
+ * amount of memory accesses, while only taking 12 bytes per code span.
+ */
+typedef struct bib_iconv_code_occupancy {
+    /**
+     * The set of assigned code units.
+     *
+     * Given an 8-bit code unit `c` and its index `n = (c & 0x7F) - 0x20`, its
+     * bit is `1 << (n % 32)` in `bits[n / 32]`.
+     */
+    uint32_t bits[3];
+} bib_iconv_code_occupancy_t;
+
 /**
  * A set of assigned code points composed of 8-bit code units mapped to their
  * equivalent Unicode code points.
@@ -497,6 +520,19 @@ typedef struct bib_iconv_charset {
      *   code table.
      */
     struct bib_iconv_code_span const *code_spans;
+
+    /**
+     * An optional array of indexes for the graphic maps in ``code_spans``.
+     *
+     * When this value isn't `NULL`, it has an entry at the same index as each
+     * span in ``code_spans``, and code units are found in a span's
+     * ``bib_iconv_code_span/graphic_map`` using its entry in this array. The
+     * entries for spans with a ``bib_iconv_code_span/graphic_set`` are unused.
+     *
+     * When this value is `NULL`, graphic maps are searched by iterating over
+     * their entries.
+     */
+    struct bib_iconv_code_occupancy const *code_occupancy;
 } bib_iconv_charset_t;
 
 #pragma mark -
@@ -0,0 +1,192 @@
+//
+//  codetable_walk.h
+//  bibiconv
+//
+
+#ifndef BIBICONV_CODETABLE_WALK_H
+#define BIBICONV_CODETABLE_WALK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <bibiconv/cfeatures.h>
+#include <bibiconv/chartypes.h>
+#include <bibiconv/codetable.h>
+#include <bibiconv/cstderrno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Count the set bits in a 32-bit value.
+ */
+static inline unsigned bib_iconv_count_bits(uint32_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcount(bits);
+#else
+    bits = bits - ((bits >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+    return (unsigned)((bits * 0x01010101) >> 24);
+#endif
+}
+
+/**
+ * Find the code unit information for a code unit in a code span.
+ *
+ * - parameter charset: The character set that the span belongs to.
+ * - parameter index: The index of the span in the character set's
+ *   ``bib_iconv_charset/code_spans`` array.
+ * - parameter unit: The code unit to look up.
+ * - parameter info: The location to store the code unit's information.
+ * - returns: `0` when the code unit is assigned in the span, and `EILSEQ` when
+ *   it isn't.
+ */
+static inline errno_t
+bib_iconv_span_walk(struct bib_iconv_charset const *charset, size_t index,
+                    unsigned char unit, union bib_iconv_code_info *info) {
+    struct bib_iconv_code_span const *span = &charset->code_spans[index];
+    if (span->graphic_set != nullptr) {
+        /* The span is a constant-time lookup table of code units. */
+        unit &= 0x7F;
+        if (unit < 0x20) {
+            /* The graphic set never contains values less than 0x20. */
+            return EILSEQ;
+        }
+        *info = span->graphic_set->lookup_table[unit - 0x20];
+        return 0;
+    }
+    if (span->graphic_map == nullptr) {
+        /* An empty span starts over from the character set's code table. */
+        *info = charset->code_table.lookup_table[unit];
+        return 0;
+    }
+    unit &= 0x7F;
+    struct bib_iconv_code_path const *map = span->graphic_map;
+    if (charset->code_occupancy != nullptr) {
+        /* The graphic map is indexed by the bits of its assigned units. */
+        if (unit < 0x20) {
+            return EILSEQ;
+        }
+        unsigned const bit = unit - 0x20;
+        uint32_t const *bits = charset->code_occupancy[index].bits;
+        uint32_t const mask = (uint32_t)1 << (bit % 32);
+        if ((bits[bit / 32] & mask) == 0) {
+            /* The code unit isn't assigned in this span. */
+            return EILSEQ;
+        }
+        /* The graphic map is sorted by code unit, so the amount of assigned
+         * code units before this one is the index of its entry. */
+        unsigned position = bib_iconv_count_bits(bits[bit / 32] & (mask - 1));
+        for (unsigned word = 0; word < bit / 32; word += 1) {
+            position += bib_iconv_count_bits(bits[word]);
+        }
+        *info = map[position].code_info;
+        return 0;
+    }
+    /* The span is an O(n) time lookup array of code units. */
+    for (; map->code_unit != 0x00; map += 1) {
+        if (map->code_unit == unit) {
+            *info = map->code_info;
+            return 0;
+        }
+    }
+    return EILSEQ;
+}
+
+/**
+ * Follow the code unit information for the first code unit of an encoded code
+ * point through the rest of its code units to get its Unicode code point.
+ *
+ * - parameter charset: The character set with the code spans to follow.
+ * - parameter info: The code unit information for the code unit at `location`
+ *   in `input`, which must be less than `length`.
+ * - parameter length: The total amount of code units in `input`.
+ * - parameter input: A string of code units to convert.
+ * - parameter location: The index of the code unit in `input` to treat as the
+ *   beginning of an encoded code point. This value is set to the index of the
+ *   next code unit in the string after a successful conversion, and is left
+ *   unchanged on failure.
+ * - parameter code_point: The location to store the resulting code point and
+ *   its combining character flag.
+ * - returns: `0` after a successful conversion, `EINVAL` when `input` ends in
+ *   the middle of a multibyte code point, and `EILSEQ` when the code units
+ *   don't form a valid code point in the character set.
+ *
+ * This lets a caller look up the first code unit somewhere other than the
+ * character set's own ``bib_iconv_charset/code_table``.
+ */
+static inline errno_t
+bib_iconv_code_walk(struct bib_iconv_charset const *charset,
+                    union bib_iconv_code_info info,
+                    size_t length, char const input[length],
+                    size_t *location, bib_iconv_code_point_t *code_point) {
+    size_t loc = *location;
+    while (!info.is_final_unit) {
+        /* The code unit is the first or middle byte in a multibyte sequence,
+         * so follow the span index to look up the next code unit. */
+        loc += 1;
+        if (charset->code_spans == nullptr) {
+            return EILSEQ;
+        }
+        if (length <= loc) {
+            return EINVAL;
+        }
+        size_t const index = info.span_index.span_offset;
+        errno_t const error = bib_iconv_span_walk(charset, index, input[loc],
+                                                  &info);
+        if (error != 0) {
+            return error;
+        }
+    }
+    if (info.code_point.unicode == UCS4_NONCHAR) {
+        return EILSEQ;
+    }
+    *code_point = info.code_point;
+    *location = loc + 1;
+    return 0;
+}
+
+/**
+ * Convert a sequence of encoded code units into a Unicode code point.
+ *
+ * - parameter charset: The character set structure with the relevant Unicode
+ *   conversion information.
+ * - parameter length: The total amount of code units in `input`.
+ * - parameter input: A string of code units to convert.
+ * - parameter location: The index of the code unit in `input` to treat as the
+ *   beginning of an encoded code point. This value is set to the index of the
+ *   next code unit in the string after a successful conversion, and is left
+ *   unchanged on failure.
+ * - parameter code_point: The location to store the resulting code point and
+ *   its combining character flag.
+ * - returns: `0` after a successful conversion, `EINVAL` when there are no
+ *   code units left in `input` at `location`, and `EILSEQ` when the code units
+ *   don't form a valid code point in the character set, including a multibyte
+ *   code point cut short at the end of `input`.
+ *
+ * This is the same conversion as ``bib_iconv_charset_lookup``, but follows
+ * each code unit of a multibyte sequence in a loop, and reports failures with
+ * its return value instead of `errno`. Being `static inline`, it can be
+ * inlined into decoding loops.
+ */
+static inline errno_t
+bib_iconv_charset_walk(struct bib_iconv_charset const *charset,
+                       size_t length, char const input[length],
+                       size_t *location, bib_iconv_code_point_t *code_point) {
+    if (length <= *location) {
+        return EINVAL;
+    }
+    unsigned char const unit = input[*location];
+    errno_t const error =
+        bib_iconv_code_walk(charset, charset->code_table.lookup_table[unit],
+                            length, input, location, code_point);
+    return (error == EINVAL) ? EILSEQ : error;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* BIBICONV_CODETABLE_WALK_H */
@@ -0,0 +1,95 @@
+//
+//  encoding_names.c
+//  bibiconv
+//
+
+#include "bibiconv.h"
+#include "cfeatures.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * The longest normalized encoding name in ``encoding_aliases``, plus room for
+ * its null terminator.
+ */
+#define ENCODING_NAME_SIZE 16
+
+/** The number of bits of an encoding name's hash used as its slot index. */
+#define ENCODING_HASH_BITS 5
+
+/**
+ * The starting value for an encoding name's hash, which was chosen so that
+ * every name in ``encoding_aliases`` hashes to its own slot.
+ */
+#define ENCODING_HASH_SEED 0x1CE2
+
+/**
+ * A name for an encoding, normalized to lowercase without any `'-'`, `'_'`,
+ * `'.'`, `'/'`, or `' '` characters.
+ */
+struct encoding_alias {
+    char const name[ENCODING_NAME_SIZE];
+    bib_iconv_encoding_t encoding;
+};
+
+/**
+ * A perfect hash table of encoding names, indexed by the top
+ * ``ENCODING_HASH_BITS`` bits of each name's 32-bit FNV-1a hash, starting from
+ * ``ENCODING_HASH_SEED`` instead of the usual offset basis.
+ *
+ * To add a name, add it to its slot, or when its slot is taken, search for a
+ * new seed that gives every name its own slot and lay the table out again.
+ */
+static struct encoding_alias const encoding_aliases[1 << ENCODING_HASH_BITS] = {
+    [ 1] = { "wchar", BIB_ICONV_UTF32 },
+    [ 3] = { "ansinisoz3947", BIB_ICONV_MARC8 },
+    [ 6] = { "ansel", BIB_ICONV_MARC8 },
+    [10] = { "char", BIB_ICONV_UTF8 },
+    [12] = { "ucs2", BIB_ICONV_UTF16 },
+    [13] = { "ucs4", BIB_ICONV_UTF32 },
+    [16] = { "utf8", BIB_ICONV_UTF8 },
+    [17] = { "z3947", BIB_ICONV_MARC8 },
+    [19] = { "utf32", BIB_ICONV_UTF32 },
+    [20] = { "utf16", BIB_ICONV_UTF16 },
+    [21] = { "nisoz3947", BIB_ICONV_MARC8 },
+    [24] = { "marc8", BIB_ICONV_MARC8 },
+    [26] = { "ansiz3947", BIB_ICONV_MARC8 },
+    [27] = { "iso10646ucs2", BIB_ICONV_UTF16 },
+    [28] = { "iso10646ucs4", BIB_ICONV_UTF32 },
+    [30] = { "wchart", BIB_ICONV_UTF32 },
+};
+
+bib_iconv_encoding_t bib_iconv_encoding(char const *name) {
+    if (name == nullptr || name[0] == '\0') {
+        return BIB_ICONV_UTF8;
+    }
+
+    /* Normalize the name and hash it in one pass. */
+    char normalized[ENCODING_NAME_SIZE];
+    size_t length = 0;
+    uint32_t hash = ENCODING_HASH_SEED;
+    for (; *name != '\0'; name += 1) {
+        unsigned char c = (unsigned char)*name;
+        if (c == '-' || c == '_' || c == '.' || c == '/' || c == ' ') {
+            continue;
+        }
+        if (c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+        if (length + 1 >= ENCODING_NAME_SIZE) {
+            /* The name is longer than any known name. */
+            return BIB_ICONV_UNKNOWN;
+        }
+        normalized[length] = (char)c;
+        length += 1;
+        hash = (hash ^ c) * 16777619;
+    }
+    normalized[length] = '\0';
+
+    struct encoding_alias const *alias =
+        &encoding_aliases[hash >> (32 - ENCODING_HASH_BITS)];
+    if (strcmp(alias->name, normalized) != 0) {
+        return BIB_ICONV_UNKNOWN;
+    }
+    return alias->encoding;
+}
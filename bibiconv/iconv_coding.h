@@ -7,6 +7,7 @@
 #define BIB_ICONV_CODING_H
 
 #include <stddef.h>
+#include <stdbool.h>
 #include <bibiconv/cfeatures.h>
 #include <bibiconv/chartypes.h>
 
@@ -16,6 +17,36 @@ extern "C" {
 
 typedef struct bib_iconv_s *bib_iconv_t;
 
+/**
+ * The largest amount of bytes an encoder may write for a single code point.
+ *
+ * ``bib_iconv`` uses this value to size blocks of code points so that a whole
+ * block always fits in the destination buffer.
+ */
+#define BIB_ICONV_MAX_WRITE_SIZE 4
+
+/**
+ * The amount of code points ``bib_iconv`` decodes into a single block before
+ * handing them off to the encoder.
+ */
+#define BIB_ICONV_BLOCK_SIZE 256
+
+/**
+ * The most bytes a passthrough converter checks before copying them.
+ *
+ * Checking and copying text in spans this small keeps each span in the cache
+ * between the two passes over it.
+ */
+#define BIB_ICONV_SPAN_SIZE 1024
+
+/**
+ * The largest amount of memory a decoder may use for its context.
+ *
+ * Conversion descriptors reserve this much space after themselves, so that
+ * they always fit in ``BIB_ICONV_STORAGE_SIZE`` bytes of storage.
+ */
+#define BIB_ICONV_MAX_CONTEXT_SIZE 1536
+
 #pragma mark - Encoder
 
 /**
@@ -58,6 +89,37 @@ typedef struct bib_iconv_encoder_s {
     size_t (*write)(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
                     ucs4_t c, char **restrict dst, size_t *restrict dstleft);
 
+    /**
+     * Write a block of characters to the output buffer.
+     *
+     * - parameter cd: The conversion descriptor.
+     * - parameter e: The character encoder.
+     * - parameter block: The UCS-4 Unicode code points to write.
+     * - parameter count: The amount of code points in `block`. This value is
+     *   set to the amount of code points written to the destination buffer.
+     * - parameter dst: The destination buffer to write the converted
+     *   characters to. This buffer is modified to start after the last
+     *   character written to it.
+     * - parameter dstleft: The amount of bytes left in the destination buffer.
+     *   This value is set to the length of the buffer after it's been modified
+     *   to point after the last character written to it.
+     * - returns: `0` on a successful write, and `(size_t)-1` on a failure. A
+     *   non-zero positive integer is returned when a non-identical conversion
+     *   is written to the destination buffer.
+     *
+     * The capacity of the destination buffer is checked once for the whole
+     * block, assuming ``BIB_ICONV_MAX_WRITE_SIZE`` bytes per code point, and
+     * nothing is written when there isn't enough room. When a code point can't
+     * be encoded, the characters before it are written and `count` identifies
+     * the failing code point.
+     *
+     * This field is optional. ``bib_iconv`` falls back to ``write`` for each
+     * code point when it's `NULL`.
+     */
+    size_t (*write_block)(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
+                          ucs4_t const *restrict block, size_t *restrict count,
+                          char **restrict dst, size_t *restrict dstleft);
+
     size_t (*flush)(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
                     char **restrict dst, size_t *restrict dstleft);
 
@@ -95,6 +157,18 @@ void bib_iconv_open_utf32_encoder(bib_iconv_encoder_t e);
 
 #pragma mark - Decoder
 
+/**
+ * The state that a decoder carries from one character to the next, saved
+ * between two characters so that decoding can resume from that point.
+ *
+ * Each decoder chooses what its identifiers mean. A decoder for a stateless
+ * encoding doesn't save anything.
+ */
+typedef struct bib_iconv_shift_state {
+    /** Identifiers for the character sets that the decoder has shifted into. */
+    unsigned char charsets[4];
+} bib_iconv_shift_state_t;
+
 /**
  * A collection of functions and state used to read characters from a particular
  * encoding.
@@ -102,9 +176,18 @@ void bib_iconv_open_utf32_encoder(bib_iconv_encoder_t e);
 typedef struct bib_iconv_decoder_s {
     /**
      * Arbitrary private data used by the decoder to keep track of state.
+     *
+     * This points to ``context_size`` bytes of memory owned by the conversion
+     * descriptor, which are filled with zeros until ``init`` is first called.
      */
     void *context;
 
+    /**
+     * The amount of memory the decoder needs for its ``context``, which is no
+     * more than ``BIB_ICONV_MAX_CONTEXT_SIZE``.
+     */
+    size_t context_size;
+
     /**
      * Set up ``context`` with initial values at the beginning of conversion.
      *
@@ -119,7 +202,9 @@ typedef struct bib_iconv_decoder_s {
      *   the last character read.
      * - returns: `0` on successful initialization, and `(size_t)-1` on failure.
      *
-     * ``bib_iconv`` may call this multiple times before calling ``deinit``.
+     * ``bib_iconv`` may call this multiple times before calling ``deinit``,
+     * once at the start of each conversion after a flush or reset. Set up
+     * ``context`` the first time, and reset it in place after that.
      */
     size_t (*init)(bib_iconv_t cd, struct bib_iconv_decoder_s *d,
                    char const **restrict src, size_t *restrict srcleft);
@@ -147,7 +232,66 @@ typedef struct bib_iconv_decoder_s {
                    ucs4_t *unicode);
 
     /**
-     * Clean up and deallocate the decoder's ``context``.
+     * Read a block of UCS-4 characters from the input buffer.
+     *
+     * - parameter cd: The conversion descriptor.
+     * - parameter d: The character decoder.
+     * - parameter src: The source buffer to read encoded data from. This buffer
+     *   is modified to start after the last character read from the buffer.
+     * - parameter srcleft: The amount of bytes left in the input buffer to
+     *   read. This value is set to the length of the buffer after it's been
+     *   modified to point after the last character read.
+     * - parameter block: The caller-owned buffer to store the converted UCS-4
+     *   Unicode code points in.
+     * - parameter count: The capacity of `block`. This value is set to the
+     *   amount of code points stored in `block`, even when the function fails.
+     * - returns: `0` upon a successful conversion, `(size_t)-1` on failure, and
+     *   a positive non-zero integer when encountering an non-identical
+     *   conversion to UCS-4 Unicode.
+     *
+     * Reading stops once `block` is full, or after a `0` code point is stored
+     * in `block`. Decoders that can produce code points which aren't Unicode
+     * scalar values also stop right after storing one, so that an encoder
+     * rejecting it leaves `src` just after it. On failure, the code points read
+     * before the failure are kept in `block` and `src` points at the sequence
+     * that couldn't be read.
+     *
+     * This field is optional. ``bib_iconv`` falls back to ``read`` for each
+     * code point when it's `NULL`.
+     */
+    size_t (*read_block)(bib_iconv_t cd, struct bib_iconv_decoder_s *d,
+                         char const **restrict src, size_t *restrict srcleft,
+                         ucs4_t *restrict block, size_t *restrict count);
+
+    /**
+     * Save the decoder's shift state between two characters.
+     *
+     * - parameter d: The character decoder.
+     * - parameter state: The location to store the shift state.
+     *
+     * This is only called after a read stops at a character boundary, with no
+     * part of a character left in ``context``. This field is optional, and is
+     * `NULL` for decoders without a shift state.
+     */
+    void (*save)(struct bib_iconv_decoder_s *d,
+                 bib_iconv_shift_state_t *restrict state);
+
+    /**
+     * Restore a shift state saved by ``save``, so that the next read decodes
+     * the characters after the point where it was saved.
+     *
+     * - parameter d: The character decoder, initialized with ``init``.
+     * - parameter state: The shift state to restore.
+     *
+     * This field is optional, and is `NULL` for decoders without a shift
+     * state.
+     */
+    void (*restore)(struct bib_iconv_decoder_s *d,
+                    bib_iconv_shift_state_t const *restrict state);
+
+    /**
+     * Clean up the decoder's ``context``, which is deallocated along with the
+     * conversion descriptor.
      *
      * - parameter d: The character decoder to uninitialize.
      */
@@ -162,6 +306,41 @@ typedef struct bib_iconv_decoder_s {
  */
 void bib_iconv_open_marc8_decoder(bib_iconv_decoder_t d);
 
+/** The ways that a MARC-8 decoder can normalize the text it decodes. */
+typedef enum bib_iconv_normalization {
+    /** Combining characters are decoded in the order that they're read. */
+    BIB_ICONV_NORMALIZE_NONE = 0,
+
+    /**
+     * The combining characters that modify each character are sorted into
+     * canonical order by their canonical combining classes.
+     */
+    BIB_ICONV_NORMALIZE_ORDER,
+
+    /**
+     * The combining characters that modify each character are sorted into
+     * canonical order, and composed with the character into precomposed
+     * characters, as in Unicode Normalization Form C (NFC).
+     */
+    BIB_ICONV_NORMALIZE_NFC,
+} bib_iconv_normalization_t;
+
+/**
+ * Sets up a decoder with all the functions necessary to decode MARC-8 encoded
+ * text into normalized Unicode text.
+ *
+ * - parameter d: Allocated space for a decoder.
+ * - parameter normalization: How to normalize the decoded text.
+ *
+ * This decodes the same as ``bib_iconv_open_marc8_decoder``, except that each
+ * run of combining characters is normalized before it's returned after the
+ * character it modifies. The fused MARC-8 converters normalize their output
+ * the same way when given this decoder.
+ */
+void bib_iconv_open_marc8_normalizing_decoder(bib_iconv_decoder_t d,
+                                              bib_iconv_normalization_t
+                                                  normalization);
+
 /**
  * Sets up a decoder with all the functions necessary to decode UTF-8 encoded
  * text.
@@ -186,6 +365,220 @@ void bib_iconv_open_utf16_decoder(bib_iconv_decoder_t d);
  */
 void bib_iconv_open_utf32_decoder(bib_iconv_decoder_t d);
 
+#pragma mark - Fused Converters
+
+/**
+ * Convert MARC-8 encoded text directly to UTF-8 encoded text.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter d: The MARC-8 decoder holding the conversion state, set up with
+ *   ``bib_iconv_open_marc8_decoder``.
+ * - parameter src: The source buffer to read MARC-8 encoded data from. This
+ *   buffer is modified to start after the last character read from it.
+ * - parameter srcleft: The amount of bytes left in the input buffer to read.
+ *   This value is set to the length of the buffer after it's been modified to
+ *   point after the last character read.
+ * - parameter dst: The destination buffer to write the converted characters
+ *   to. This buffer is modified to start after the last character written to
+ *   it.
+ * - parameter dstleft: The amount of bytes left in the destination buffer.
+ *   This value is set to the length of the buffer after it's been modified to
+ *   point after the last character written to it.
+ * - parameter pending: The location to store a code point that was read from
+ *   the source buffer, but couldn't be written to the destination buffer.
+ * - parameter has_pending: Set to `true` when `pending` is set.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * This produces exactly the same output as pairing the MARC-8 decoder with the
+ * UTF-8 encoder, and stops under the same conditions as ``bib_iconv``: after
+ * writing a `0` code point, when the destination buffer is full, or on an
+ * error. It skips the function pointers and the intermediate UCS-4 code
+ * points for each character.
+ */
+size_t bib_iconv_convert_marc8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                       char const **restrict src,
+                                       size_t *restrict srcleft,
+                                       char **restrict dst,
+                                       size_t *restrict dstleft,
+                                       ucs4_t *restrict pending,
+                                       bool *restrict has_pending);
+
+/**
+ * Convert MARC-8 encoded text directly to UTF-16 encoded text.
+ *
+ * This is the same as ``bib_iconv_convert_marc8_to_utf8``, but writes the
+ * same output as the UTF-16 encoder.
+ */
+size_t bib_iconv_convert_marc8_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending);
+
+/**
+ * Convert MARC-8 encoded text directly to UTF-32 encoded text.
+ *
+ * This is the same as ``bib_iconv_convert_marc8_to_utf8``, but writes the
+ * same output as the UTF-32 encoder.
+ */
+size_t bib_iconv_convert_marc8_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending);
+
+/**
+ * Measure the size of MARC-8 encoded text converted to UTF-8 encoded text,
+ * without writing it.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter d: The MARC-8 decoder holding the conversion state, set up with
+ *   ``bib_iconv_open_marc8_decoder``.
+ * - parameter src: The source buffer to read MARC-8 encoded data from. This
+ *   buffer is modified to start after the last character read from it.
+ * - parameter srcleft: The amount of bytes left in the input buffer to read.
+ *   This value is set to the length of the buffer after it's been modified to
+ *   point after the last character read.
+ * - parameter size: The location to store the amount of bytes that
+ *   ``bib_iconv_convert_marc8_to_utf8`` would write for the characters read.
+ * - returns: `0` upon a successful measurement, and `(size_t)-1` on failure.
+ *
+ * This runs the same conversion as ``bib_iconv_convert_marc8_to_utf8`` with an
+ * unlimited destination buffer, counting runs of ASCII characters as a whole,
+ * and stops under the same conditions.
+ */
+size_t bib_iconv_measure_marc8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                       char const **restrict src,
+                                       size_t *restrict srcleft,
+                                       size_t *restrict size);
+
+/**
+ * Measure the size of MARC-8 encoded text converted to UTF-16 encoded text,
+ * without writing it.
+ *
+ * This is the same as ``bib_iconv_measure_marc8_to_utf8``, but measures the
+ * output of ``bib_iconv_convert_marc8_to_utf16``.
+ */
+size_t bib_iconv_measure_marc8_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size);
+
+/**
+ * Measure the size of MARC-8 encoded text converted to UTF-32 encoded text,
+ * without writing it.
+ *
+ * This is the same as ``bib_iconv_measure_marc8_to_utf8``, but measures the
+ * output of ``bib_iconv_convert_marc8_to_utf32``.
+ */
+size_t bib_iconv_measure_marc8_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size);
+
+#pragma mark - Passthrough Converters
+
+/**
+ * Copy UTF-8 encoded text, checking that it's well-formed.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter d: The UTF-8 decoder, set up with
+ *   ``bib_iconv_open_utf8_decoder``.
+ * - parameter src: The source buffer to read UTF-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the input buffer to read.
+ * - parameter dst: The destination buffer to copy the characters to.
+ * - parameter dstleft: The amount of bytes left in the destination buffer.
+ * - parameter pending: The location to store a code point that was read from
+ *   the source buffer, but couldn't be written to the destination buffer.
+ * - parameter has_pending: Set to `true` when `pending` is set.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * This takes the place of pairing the UTF-8 decoder with the UTF-8 encoder.
+ * Well-formed text is copied as it is, in spans as long as the destination
+ * buffer allows, and the copy stops under the same conditions as
+ * ``bib_iconv``. The first ill-formed sequence stops the copy with `EILSEQ`,
+ * leaving `src` at its first byte. That includes overlong encodings and
+ * encoded surrogates, which the UTF-8 decoder otherwise reads.
+ */
+size_t bib_iconv_convert_utf8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                      char const **restrict src,
+                                      size_t *restrict srcleft,
+                                      char **restrict dst,
+                                      size_t *restrict dstleft,
+                                      ucs4_t *restrict pending,
+                                      bool *restrict has_pending);
+
+/**
+ * Copy UTF-16 encoded text, checking that it's well-formed.
+ *
+ * This is the same as ``bib_iconv_convert_utf8_to_utf8``, but for UTF-16
+ * encoded text, where unpaired surrogates are ill-formed.
+ */
+size_t bib_iconv_convert_utf16_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending);
+
+/**
+ * Copy UTF-32 encoded text, checking that it's well-formed.
+ *
+ * This is the same as ``bib_iconv_convert_utf8_to_utf8``, but for UTF-32
+ * encoded text, where surrogates and code units past `0x10FFFF` are
+ * ill-formed.
+ */
+size_t bib_iconv_convert_utf32_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending);
+
+/**
+ * Measure the size of well-formed UTF-8 encoded text.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter d: The UTF-8 decoder.
+ * - parameter src: The source buffer to read UTF-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the input buffer to read.
+ * - parameter size: The location to store the amount of bytes that
+ *   ``bib_iconv_convert_utf8_to_utf8`` would copy.
+ * - returns: `0` upon a successful measurement, and `(size_t)-1` on failure.
+ */
+size_t bib_iconv_measure_utf8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                      char const **restrict src,
+                                      size_t *restrict srcleft,
+                                      size_t *restrict size);
+
+/**
+ * Measure the size of well-formed UTF-16 encoded text.
+ *
+ * This is the same as ``bib_iconv_measure_utf8_to_utf8``, but measures the
+ * output of ``bib_iconv_convert_utf16_to_utf16``.
+ */
+size_t bib_iconv_measure_utf16_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size);
+
+/**
+ * Measure the size of well-formed UTF-32 encoded text.
+ *
+ * This is the same as ``bib_iconv_measure_utf8_to_utf8``, but measures the
+ * output of ``bib_iconv_convert_utf32_to_utf32``.
+ */
+size_t bib_iconv_measure_utf32_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
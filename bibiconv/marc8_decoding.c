@@ -4,33 +4,356 @@
 //
 
 #include "marc8_tables.h"
+#include "nfc_tables.h"
 #include "iconv_coding.h"
+#include "runscan.h"
+#include "codetable_walk.h"
 #include <errno.h>
+#include <stdint.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if BIBICONV_HAS_NULLPTR
+#define nullfun nullptr
+#else
+#define nullfun ((uintptr_t)0)
+#endif
 
 #define ESCAPE_CHAR 0x1B
 
+/**
+ * The amount of characters that the fused converters read through the working
+ * set after an escape sequence changes it, before updating the decoder's
+ * ``context_t/plain_chars`` table.
+ *
+ * Input that shifts character sets every few characters is cheaper to read
+ * one character at a time than to update the table after every shift.
+ */
+#define MARC8_SHIFT_READS 4
+
+/**
+ * The most combining characters that can modify a single character.
+ *
+ * This is more than the 30 consecutive combining characters allowed by the
+ * Unicode Stream-Safe Text Format (UAX #15), and far more than the diacritics
+ * stacked in real bibliographic records. A longer run of combining characters
+ * is rejected as an invalid sequence, keeping the decoder's memory bounded.
+ */
+#define MARC8_MAX_COMBINING_CHARS 32
+
+/**
+ * The code elements currently shifted into each area of the MARC-8 code table.
+ *
+ * Each area points into one of the immutable MARC-8 character sets, so that
+ * shifting a new character set into the working set only stores pointers
+ * instead of copying lookup tables.
+ */
+typedef struct working_set {
+    /** The control set in the Control Left (CL) area, `0x00`-`0x1F`. */
+    struct bib_iconv_control_set const *cl;
+
+    /** The G0 graphic set in the Graphic Left (GL) area, `0x20`-`0x7F`. */
+    struct bib_iconv_graphic_set const *gl;
+
+    /** The control set in the Control Right (CR) area, `0x80`-`0x9F`. */
+    struct bib_iconv_control_set const *cr;
+
+    /** The G1 graphic set in the Graphic Right (GR) area, `0xA0`-`0xFF`. */
+    struct bib_iconv_graphic_set const *gr;
+
+    /**
+     * The multibyte character set most recently shifted into a graphic set,
+     * whose code spans are followed for the rest of a multibyte code point.
+     */
+    struct bib_iconv_charset const *multibyte;
+} working_set_t;
+
 /** The stateful data used by the MARC-8 decoder. */
 typedef struct context {
-    bib_iconv_charset_t working_set;
-
-    /** An array of combining characters read from the input buffer. */
-    ucs4_t *combining_chars;
+    /** The character sets used to lookup code points. */
+    working_set_t working_set;
 
-    /** The allocated size of ``combining_chars``. */
-    size_t combining_cap;
+    /**
+     * A stack of combining characters read from the input buffer, with room
+     * for the horn that a character is decomposed into when composing text
+     * into NFC.
+     */
+    ucs4_t combining_chars[MARC8_MAX_COMBINING_CHARS + 1];
 
     /** The amount of characters set in ``combining_chars``. */
     size_t combining_len;
+
+    /**
+     * A mapping of each byte to its Unicode code point in the working set, for
+     * characters that can be converted on their own.
+     *
+     * Bytes that begin escape sequences or multibyte characters, combining
+     * characters, and unassigned or ignored code points are mapped to `0`.
+     * When composing text into NFC, characters are mapped to their
+     * normalized forms.
+     */
+    ucs4_t plain_chars[256];
+
+    /**
+     * Indicates that an escape sequence changed the working set's G0 graphic
+     * set since ``plain_chars`` was last updated.
+     */
+    bool is_g0_changed;
+
+    /**
+     * Indicates that an escape sequence changed the working set's G1 graphic
+     * set since ``plain_chars`` was last updated.
+     */
+    bool is_g1_changed;
+
+    /**
+     * The amount of characters read since an escape sequence last changed the
+     * working set, while ``plain_chars`` is out of date.
+     */
+    size_t reads_since_shift;
+
+    /** How the decoded text is normalized. */
+    bib_iconv_normalization_t normalization;
 } context_t;
 
+static_assert(sizeof(context_t) <= BIB_ICONV_MAX_CONTEXT_SIZE,
+              "The MARC-8 decoder's context must fit in a descriptor.");
+
+/**
+ * Shift a character set into the working set's G0 graphic set.
+ *
+ * - parameter context: The decoder's state, with the working set to shift.
+ * - parameter charset: The character set whose GL area becomes the G0 set.
+ */
+static inline void marc8_shift_g0(context_t *context,
+                                  struct bib_iconv_charset const *charset) {
+    struct bib_iconv_graphic_set const *gl = &charset->code_table.code_areas.gl;
+    if (context->working_set.gl != gl) {
+        context->working_set.gl = gl;
+        context->is_g0_changed = true;
+        context->reads_since_shift = 0;
+    }
+}
+
+/**
+ * Shift a character set into the working set's G1 graphic set, along with its
+ * supplementary control set.
+ *
+ * - parameter context: The decoder's state, with the working set to shift.
+ * - parameter charset: The character set whose CR and GR areas become the C1
+ *   and G1 sets.
+ */
+static inline void marc8_shift_g1(context_t *context,
+                                  struct bib_iconv_charset const *charset) {
+    struct bib_iconv_graphic_set const *gr = &charset->code_table.code_areas.gr;
+    if (context->working_set.gr != gr) {
+        context->working_set.cr = &charset->code_table.code_areas.cr;
+        context->working_set.gr = gr;
+        context->is_g1_changed = true;
+        context->reads_since_shift = 0;
+    }
+}
+
+/**
+ * Look up the code unit information for a single byte in the working set.
+ *
+ * - parameter working_set: The code elements shifted into the code table.
+ * - parameter unit: The byte to look up.
+ * - returns: The code unit information from the code area containing `unit`.
+ */
+static inline union bib_iconv_code_info
+marc8_lookup_info(working_set_t const *working_set, unsigned char unit) {
+    if (unit < 0x80) {
+        return (unit < 0x20) ? working_set->cl->lookup_table[unit]
+                             : working_set->gl->lookup_table[unit - 0x20];
+    }
+    return (unit < 0xA0) ? working_set->cr->lookup_table[unit - 0x80]
+                         : working_set->gr->lookup_table[unit - 0xA0];
+}
+
+#pragma mark - Escape Sequences
+
+/** The character sets that MARC-8 escape sequences can identify. */
+typedef enum marc8_escape_charset {
+    escape_basic_latin,
+    escape_extended_latin,
+    escape_greek_symbols,
+    escape_subscript,
+    escape_superscript,
+    escape_basic_hebrew,
+    escape_basic_cyrillic,
+    escape_extended_cyrillic,
+    escape_basic_arabic,
+    escape_extended_arabic,
+    escape_basic_greek,
+    escape_eacc,
+} marc8_escape_charset_t;
+
+/** The character set for each ``marc8_escape_charset_t`` value. */
+static struct bib_iconv_charset const *const marc8_escape_charsets[] = {
+    [escape_basic_latin] = &bib_iconv_marc8_basic_latin,
+    [escape_extended_latin] = &bib_iconv_marc8_extended_latin,
+    [escape_greek_symbols] = &bib_iconv_marc8_greek_symbols,
+    [escape_subscript] = &bib_iconv_marc8_subscript,
+    [escape_superscript] = &bib_iconv_marc8_superscript,
+    [escape_basic_hebrew] = &bib_iconv_marc8_basic_hebrew,
+    [escape_basic_cyrillic] = &bib_iconv_marc8_basic_cyrillic,
+    [escape_extended_cyrillic] = &bib_iconv_marc8_extended_cyrillic,
+    [escape_basic_arabic] = &bib_iconv_marc8_basic_arabic,
+    [escape_extended_arabic] = &bib_iconv_marc8_extended_arabic,
+    [escape_basic_greek] = &bib_iconv_marc8_basic_greek,
+    [escape_eacc] = &bib_iconv_marc8_eacc,
+};
+
+/**
+ * The states of the escape sequence recognizer after reading the escape
+ * character and some of the bytes following it.
+ */
+typedef enum marc8_escape_state {
+    /** The bytes read so far aren't the start of a valid escape sequence. */
+    escape_reject,
+    /** Only the escape character has been read. */
+    escape_start,
+    /** A G0 intermediate byte, `'('` or `','`, has been read. */
+    escape_g0,
+    /** A G0 intermediate byte followed by `'!'` has been read. */
+    escape_g0_ansel,
+    /** A G1 intermediate byte, `')'` or `'-'`, has been read. */
+    escape_g1,
+    /** A G1 intermediate byte followed by `'!'` has been read. */
+    escape_g1_ansel,
+    /** The multibyte intermediate byte `'$'` has been read. */
+    escape_multibyte,
+    /** The multibyte intermediate byte followed by `'('` or `','`. */
+    escape_multibyte_g0,
+    /** The multibyte intermediate byte followed by `')'` or `'-'`. */
+    escape_multibyte_g1,
+    /** The amount of states in the recognizer. */
+    escape_state_count,
+} marc8_escape_state_t;
+
+/**
+ * Set in a transition of the escape sequence recognizer when the escape
+ * sequence is complete.
+ *
+ * The rest of the transition's bits identify the character set and code area,
+ * instead of the next ``marc8_escape_state_t`` value.
+ */
+#define ESCAPE_ACCEPT 0x80
+
+/** Set in an accepting transition that shifts into the G1 graphic set. */
+#define ESCAPE_G1 0x40
+
+/** Set in an accepting transition for a multibyte character set. */
+#define ESCAPE_MULTIBYTE 0x20
+
+/** The bits of an accepting transition that hold its character set. */
+#define ESCAPE_CHARSET_MASK 0x1F
+
+/** An accepting transition into the G0 graphic set. */
+#define G0(charset) (ESCAPE_ACCEPT | escape_##charset)
+
+/** An accepting transition into the G1 graphic set. */
+#define G1(charset) (ESCAPE_ACCEPT | ESCAPE_G1 | escape_##charset)
+
+/**
+ * The transitions of a deterministic finite automaton recognizing every valid
+ * MARC-8 escape sequence.
+ *
+ * Each row is a ``marc8_escape_state_t`` value, and each column is the next
+ * byte in the escape sequence. Unlisted bytes transition to
+ * ``marc8_escape_state_t/escape_reject``.
+ */
+static uint8_t const marc8_escape_transitions[escape_state_count][256] = {
+    [escape_start] = {
+        ['s'] = G0(basic_latin),
+        ['g'] = G0(greek_symbols),
+        ['b'] = G0(subscript),
+        ['p'] = G0(superscript),
+        ['('] = escape_g0, [','] = escape_g0,
+        [')'] = escape_g1, ['-'] = escape_g1,
+        ['$'] = escape_multibyte,
+    },
+    [escape_g0] = {
+        ['!'] = escape_g0_ansel,
+        ['B'] = G0(basic_latin),
+        ['2'] = G0(basic_hebrew),
+        ['N'] = G0(basic_cyrillic),
+        ['Q'] = G0(extended_cyrillic),
+        ['3'] = G0(basic_arabic),
+        ['4'] = G0(extended_arabic),
+        ['S'] = G0(basic_greek),
+    },
+    [escape_g0_ansel] = {
+        ['E'] = G0(extended_latin),
+    },
+    [escape_g1] = {
+        ['!'] = escape_g1_ansel,
+        ['B'] = G1(basic_latin),
+        ['2'] = G1(basic_hebrew),
+        ['N'] = G1(basic_cyrillic),
+        ['Q'] = G1(extended_cyrillic),
+        ['3'] = G1(basic_arabic),
+        ['4'] = G1(extended_arabic),
+        ['S'] = G1(basic_greek),
+    },
+    [escape_g1_ansel] = {
+        ['E'] = G1(extended_latin),
+    },
+    [escape_multibyte] = {
+        ['('] = escape_multibyte_g0, [','] = escape_multibyte_g0,
+        [')'] = escape_multibyte_g1, ['-'] = escape_multibyte_g1,
+        ['1'] = G0(eacc) | ESCAPE_MULTIBYTE,
+    },
+    [escape_multibyte_g0] = {
+        ['1'] = G0(eacc) | ESCAPE_MULTIBYTE,
+    },
+    [escape_multibyte_g1] = {
+        ['1'] = G1(eacc) | ESCAPE_MULTIBYTE,
+    },
+};
+
+#undef G0
+#undef G1
+
+/**
+ * Recognize the escape sequence at the start of the `input` string.
+ *
+ * - parameter length: The length of the input string.
+ * - parameter input: A string of code units beginning with the escape
+ *   character (`0x1B`, `'\e'`).
+ * - parameter consumed: The location to store the amount of code units read
+ *   from `input`, including the escape character.
+ * - returns: An accepting transition from ``marc8_escape_transitions`` for a
+ *   valid escape sequence, ``marc8_escape_state_t/escape_reject`` when the
+ *   escape sequence is invalid, or the recognizer's last state when the escape
+ *   sequence is cut short at the end of the input string.
+ */
+static inline uint8_t marc8_match_escape(size_t length,
+                                         char const input[length],
+                                         size_t *consumed) {
+    uint8_t state = escape_start;
+    size_t loc = 1;
+    while (loc < length) {
+        state = marc8_escape_transitions[state][(unsigned char)input[loc]];
+        loc += 1;
+        if (state == escape_reject || (state & ESCAPE_ACCEPT) != 0) {
+            *consumed = loc;
+            return state;
+        }
+    }
+    *consumed = loc;
+    return state;
+}
+
 /**
  * Read an escape sequence from the `input` string of code units, and shift the
- * working set `charset` in the appropriate code area into the character set
- * identified by the shift sequence.
+ * working set in the appropriate code area into the character set identified
+ * by the shift sequence.
  *
- * - parameter charset: The working set used to lookup code points.
+ * - parameter context: The decoder's state, with the working set used to
+ *   lookup code points. The code areas that are shifted are marked as changed.
  * - parameter length: The length of the input string.
  * - parameter input: A string of code units containing the escape sequence.
  * - parameter location: The current location in the `input` string. The
@@ -41,7 +364,7 @@ typedef struct context {
  *   character set identified by the escape sequence. false` when the escape
  *   sequence is invalid or cut short at the end of the input string.
  */
-static bool marc8_read_escape(struct bib_iconv_charset *charset,
+static bool marc8_read_escape(context_t *context,
                               size_t length, char const input[length],
                               size_t *location) {
     if (length == 0 || input == nullptr || location == nullptr) {
@@ -50,308 +373,176 @@ static bool marc8_read_escape(struct bib_iconv_charset *charset,
     }
 
     /** The current location in input to read characters from. */
-    size_t loc = *location;
+    size_t const loc = *location;
 
-    if ((loc < length) && input[loc] == ESCAPE_CHAR) {
-        loc += 1;
-    } else {
+    if (loc >= length || input[loc] != ESCAPE_CHAR) {
         /* Invalid argument. Not an escape sequence. */
         errno = EINVAL;
         return false;
     }
 
-    if (loc < length) {
-        switch (input[loc]) {
-            case 0x67: /* 'g' is G0 Greek symbol set. */
-                charset->code_table.code_areas.gl =
-                    bib_iconv_marc8_greek_symbols.code_table.code_areas.gl;
-                *location = loc + 1;
-                return true;
-
-            case 0x62: /* 'b' is G0 Subscript set. */
-                charset->code_table.code_areas.gl =
-                    bib_iconv_marc8_subscript.code_table.code_areas.gl;
-                *location = loc + 1;
-                return true;
-
-            case 0x70: /* 'p' is G0 Superscript set. */
-                charset->code_table.code_areas.gl =
-                    bib_iconv_marc8_superscript.code_table.code_areas.gl;
-                *location = loc + 1;
-                return true;
-
-            case 0x73: /* 's' is G0 ASCII  */
-                charset->code_table.code_areas.gl =
-                    bib_iconv_marc8_basic_latin.code_table.code_areas.gl;
-                *location = loc + 1;
-                return true;
-
-            /* Valid first intermediate bytes: */
-            case 0x24: /* '$' denotes multibyte characters. */
-            case 0x28: /* '(' sets the G0 code page. */
-            case 0x2C: /* ',' sets the G0 code page. */
-            case 0x29: /* ')' sets the G1 code page. */
-            case 0x2D: /* '-' sets the G1 code page. */
-                break;
-
-            default:
-                /* Invalid escape sequence. */
-                errno = EILSEQ;
-                return false;
-        }
-    }
-
-    /**
-     * The control set that may be modified by the escape sequence.
-     */
-    struct bib_iconv_control_set *control = nullptr;
-    /**
-     * The graphic set that will be modified by the escape sequence.
-     */
-    struct bib_iconv_graphic_set *graphic = nullptr;
-    /**
-     * Indicates that the escape sequence should identify the Extended Latin
-     * character set.
-     */
-    bool expect_ansel_encoding = false;
-    /**
-     * Indicates that the escape sequence identifies a multibyte character set.
-     *
-     * \note The only valid multibyte character set for MARC-8 is EACC set.
-     * \note Multibyte sequence implies the G0 code area.
-     */
-    bool is_multibyte_sequence = false;
-    /**
-     * Indicates that a multibyte sequence implies the G0 code area.
-     */
-    bool is_g0_implied = false;
-    /**
-     * Indicates that the G0 code area will be modified by the escape sequence.
-     */
-    bool is_g0 = false;
-    /**
-     * Indicates that the G1 code area will be modified by the escape sequence.
-     */
-    bool is_g1 = false;
-
-    /* Intermediate bytes are 0x20-0x2F */
-    while ((loc < length) && (input[loc] & 0xF0) == 0x20) {
-        switch (input[loc]) {
-            case 0x21: /* '!' is a special-case for ANSEL. */
-                /* This must come after a code page indicator. */
-                if (graphic == nullptr) {
-                    errno = EILSEQ;
-                    return false;
-                }
-                /* ASNEL is not a multibyte code set. */
-                /* Cannot have multiple ANSEL markers in a row. */
-                if (is_multibyte_sequence || expect_ansel_encoding) {
-                    errno = EILSEQ;
-                    return false;
-                }
-                loc += 1;
-                expect_ansel_encoding = true;
-                continue;
-
-            case 0x24: /* '$' denotes multibyte characters. */
-                /* This must precede a code page indicator. */
-                /* You can only have one multibyte indicator. */
-                if (graphic != nullptr || is_multibyte_sequence) {
-                    errno = EILSEQ;
-                    return false;
-                }
-                loc += 1;
-                /* GL code area is implied. */
-                graphic = &charset->code_table.code_areas.gl;
-                is_multibyte_sequence = true;
-                is_g0_implied = true;
-                continue;
-
-            case 0x28: /* '(' sets the G0 code page. */
-            case 0x2C: /* ',' sets the G0 code page. */
-                if (graphic != nullptr && !is_multibyte_sequence) {
-                    /* You can only have one page indicator. */
-                    errno = EILSEQ;
-                    return false;
-                }
-                if (is_g0 || is_g1) {
-                    /* You can only have one page indicator. */
-                    errno = EILSEQ;
-                    return false;
-                }
-                loc += 1;
-                graphic = &charset->code_table.code_areas.gl;
-                is_g0 = true;
-                continue;
-
-            case 0x29: /* ')' sets the G1 code page. */
-            case 0x2D: /* '-' sets the G1 code page. */
-                if (graphic != nullptr && !is_multibyte_sequence) {
-                    /* You can only have one page indicator. */
-                    errno = EILSEQ;
-                    return false;
-                }
-                if (is_g0 || is_g1) {
-                    /* You can only have one page indicator. */
-                    errno = EILSEQ;
-                    return false;
-                }
-                loc += 1;
-                graphic = &charset->code_table.code_areas.gr;
-                control = &charset->code_table.code_areas.cr;
-                is_g1 = true;
-                continue;
-
-            default: /* Unrecognized intermediate byte. */
-                errno = EILSEQ;
-                return false;
-        }
-    }
-
-    /* Make sure the implied G0 character set is used only when the G1 or G1
-     * code areas haven't been explicitly identified in the escape sequence. */
-    if (is_g0_implied && !(is_g0 || is_g1)) {
-        is_g0 = true;
-    }
-
-    /* Asset that only one graphic set is identified by the escape sequence. */
-    /* This should be taken care of by the checks in the while loop, so this
-     * assert is only here for a sanity check during debug. */
-    assert((is_g0 || is_g1) && !(is_g0 && is_g1));
-
-    if (loc >= length) {
-        /* Premature end of escape sequence. */
+    size_t consumed = 0;
+    uint8_t const match = marc8_match_escape(length - loc, input + loc,
+                                             &consumed);
+    if (match == escape_reject) {
         errno = EILSEQ;
         return false;
     }
+    if ((match & ESCAPE_ACCEPT) == 0) {
+        /* The rest of the escape sequence may be in the next input buffer. */
+        errno = EINVAL;
+        return false;
+    }
 
     /** The new character set identified by the escape sequence. */
-    struct bib_iconv_charset const *new_charset = nullptr;
-
-    /* Lookup the character set based on the final character. */
-    switch (input[loc]) {
-        case 0x33: /* '3' is Basic Arabic */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Basic Arabic must not have the intermediate '!'. */
-                /* Basic Arabic is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_basic_arabic;
-            break;
-
-        case 0x34: /* '4' is Extended Arabic */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Extended Arabic must not have the intermediate '!'. */
-                /* Extended Arabic is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_extended_arabic;
-            break;
-
-        case 0x42: /* 'B' is Basic Latin (ASCII). */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* ASCII must not have the intermediate '!'. */
-                /* ASCII is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_basic_latin;
-            break;
-
-        case 0x45: /* 'E' is Extended Latin (ANSEL). */
-            if (!expect_ansel_encoding || is_multibyte_sequence) {
-                /* ANSEL encoding is special and requires intermediate '!'. */
-                /* ANSEL is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_extended_latin;
-            break;
-
-        case 0x31: /* '1' is Chinese, Japanese, Korean (EACC). */
-            if (expect_ansel_encoding || !is_multibyte_sequence) {
-                /* EACC must not have the intermediate '!'. */
-                /* EACC is a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_eacc;
-            break;
+    struct bib_iconv_charset const *new_charset =
+        marc8_escape_charsets[match & ESCAPE_CHARSET_MASK];
+    if (match & ESCAPE_G1) {
+        marc8_shift_g1(context, new_charset);
+    } else {
+        marc8_shift_g0(context, new_charset);
+    }
+    if (match & ESCAPE_MULTIBYTE) {
+        context->working_set.multibyte = new_charset;
+    }
 
-        case 0x4E: /* 'N' is Basic Cyrillic. */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Basic Cyrillic must not have the intermediate '!'. */
-                /* Basic Cyrillic is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_basic_cyrillic;
-            break;
+    *location = loc + consumed;
+    return true;
+}
 
-        case 0x51: /* 'Q' is Extended Cyrillic. */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Extended Cyrillic must not have the intermediate '!'. */
-                /* Extended Cyrillic is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_extended_cyrillic;
-            break;
+#pragma mark - Decoding
 
-        case 0x53: /* 'S' is Basic Greek. */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Basic Greek must not have the intermediate '!'. */
-                /* Basic Greek is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
-            }
-            new_charset = &bib_iconv_marc8_basic_greek;
-            break;
+/**
+ * Sort the combining characters that modify a character into canonical order.
+ *
+ * - parameter context: The decoder's state, with the combining characters
+ *   read before the character.
+ *
+ * Combining characters are returned from the end of
+ * ``context_t/combining_chars``, so they're sorted with the greatest canonical
+ * combining class first. Combining characters with the same class keep their
+ * order, since swapping them would change the text's meaning.
+ */
+static inline void marc8_order(context_t *context) {
+    ucs4_t *chars = context->combining_chars;
+    size_t const len = context->combining_len;
+    unsigned char classes[MARC8_MAX_COMBINING_CHARS + 1];
+    for (size_t index = 0; index < len; index += 1) {
+        classes[index] = bib_iconv_combining_class(chars[index]);
+    }
+    /* An insertion sort is stable, and quick for the handful of combining
+     * characters stacked on a character. */
+    for (size_t index = 1; index < len; index += 1) {
+        ucs4_t const mark = chars[index];
+        unsigned char const mark_class = classes[index];
+        size_t slot = index;
+        while (slot > 0 && classes[slot - 1] < mark_class) {
+            chars[slot] = chars[slot - 1];
+            classes[slot] = classes[slot - 1];
+            slot -= 1;
+        }
+        chars[slot] = mark;
+        classes[slot] = mark_class;
+    }
+}
 
-        case 0x32: /* '2' is Basic Hebrew. */
-            if (expect_ansel_encoding || is_multibyte_sequence) {
-                /* Basic Hebrew must not have the intermediate '!'. */
-                /* Basic Hebrew is not a multibyte character set. */
-                errno = EILSEQ;
-                return false;
+/**
+ * Compose a character with the combining characters that modify it, as far as
+ * they have precomposed forms.
+ *
+ * - parameter context: The decoder's state, with the combining characters
+ *   read before the character in canonical order.
+ * - parameter c: The character modified by the combining characters.
+ * - returns: The composed character. The combining characters that it's
+ *   composed with are removed from ``context_t/combining_chars``.
+ *
+ * Each combining character is composed with the character unless it's
+ * blocked by a combining character of the same class before it that wasn't
+ * composed, following the canonical composition algorithm of Unicode
+ * Normalization Form C.
+ */
+static inline ucs4_t marc8_compose(context_t *context, ucs4_t c) {
+    c = bib_iconv_nfc_singleton(c);
+    ucs4_t *chars = context->combining_chars;
+    size_t const len = context->combining_len;
+    /* The class of the last combining character that wasn't composed. The
+     * combining characters are in canonical order, so it blocks any later one
+     * with the same class from composing. */
+    bool has_blocker = false;
+    unsigned char blocking_class = 0;
+    /* The combining characters that aren't composed are moved to the end of
+     * the stack, in the same order, as they're returned. */
+    size_t kept = len;
+    for (size_t index = len; index > 0; index -= 1) {
+        ucs4_t const mark = chars[index - 1];
+        unsigned char const mark_class = bib_iconv_combining_class(mark);
+        if (!has_blocker || (blocking_class != 0
+                             && blocking_class < mark_class)) {
+            ucs4_t const composite = bib_iconv_nfc_compose(c, mark);
+            if (composite != 0) {
+                c = composite;
+                continue;
             }
-            new_charset = &bib_iconv_marc8_basic_hebrew;
-            break;
-
-        default: /* No other character sets are supported. */
-            errno = EILSEQ;
-            return false;
+        }
+        has_blocker = true;
+        blocking_class = mark_class;
+        kept -= 1;
+        chars[kept] = mark;
     }
-    loc += 1;
+    memmove(chars, &chars[kept], (len - kept) * sizeof(ucs4_t));
+    context->combining_len = len - kept;
+    return c;
+}
 
-    if (is_g0) {
-        *graphic = new_charset->code_table.code_areas.gl;
-    } else if (is_g1) {
-        assert(control != nullptr);
-        *control = new_charset->code_table.code_areas.cr;
-        *graphic = new_charset->code_table.code_areas.gr;
+/**
+ * Normalize a character and the combining characters that modify it.
+ *
+ * - parameter context: The decoder's state, with the combining characters
+ *   read before the character.
+ * - parameter c: The character modified by the combining characters.
+ * - returns: The normalized character, which is followed by whatever
+ *   combining characters are left in ``context_t/combining_chars``.
+ */
+static inline ucs4_t marc8_normalize(context_t *context, ucs4_t c) {
+    if (context->normalization == BIB_ICONV_NORMALIZE_NFC
+        && context->combining_len > 0) {
+        /* Decompose a letter with a horn, so that a cedilla or an ogonek is
+         * ordered before the horn. The horn comes right after the letter, so
+         * it goes on the end of the stack. */
+        ucs4_t mark = 0;
+        ucs4_t const starter = bib_iconv_nfc_decompose(c, &mark);
+        if (mark != 0) {
+            context->combining_chars[context->combining_len] = mark;
+            context->combining_len += 1;
+            c = starter;
+        }
     }
-    if (is_multibyte_sequence) {
-        charset->code_spans = new_charset->code_spans;
+    if (context->combining_len > 1) {
+        marc8_order(context);
     }
-
-    *location = loc;
-    return true;
+    if (context->normalization == BIB_ICONV_NORMALIZE_NFC) {
+        c = marc8_compose(context, c);
+    }
+    return c;
 }
 
-static size_t marc8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
-                         char const **restrict src, size_t *restrict srcleft,
-                         ucs4_t *unicode) {
-    assert(cd != nullptr);
-    assert(d != nullptr);
-    assert(src != nullptr);
-    assert(*src != nullptr);
-    assert(srcleft != nullptr);
-    assert(d->context != nullptr);
-    context_t *context = (context_t *)d->context;
-
+/**
+ * Read the next Unicode code point from the `src` buffer.
+ *
+ * - parameter context: The decoder's state, with the current working set.
+ * - parameter src: The source buffer to read MARC-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the `src` buffer.
+ * - parameter unicode: The location to store the decoded code point.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * This is the body of ``marc8_read``, shared with the fused converters so that
+ * they decode exactly the same way without going through the decoder's
+ * function pointers.
+ */
+static inline size_t marc8_decode(context_t *context,
+                                  char const **restrict src,
+                                  size_t *restrict srcleft,
+                                  ucs4_t *unicode) {
     if (context->combining_len > 0) {
         /* If there are any combining characters, return them first in reverse
          * order before going on to read any more code points. */
@@ -360,6 +551,12 @@ static size_t marc8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
         return 0;
     }
 
+    if (*srcleft == 0) {
+        /* There's nothing left in the input buffer to read. */
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+
     unsigned char c = **src;
     while (c == ESCAPE_CHAR) {
         /* Read all escape sequences and perform the necessary shifts of the
@@ -368,16 +565,26 @@ static size_t marc8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
         size_t const initial_srcleft = *srcleft;
         size_t len = *srcleft;
         size_t loc = 0;
-        if (!marc8_read_escape(&context->working_set, len, *src, &loc)) {
+        if (!marc8_read_escape(context, len, *src, &loc)) {
             *src = initial_src;
             *srcleft = initial_srcleft;
             return (size_t)-1;
         }
         *src += loc;
         *srcleft -= loc;
+        if (*srcleft == 0) {
+            /* The input ended with an escape sequence. */
+            errno = EINVAL;
+            return (size_t)-1;
+        }
         c = **src;
     }
 
+    /* The location of the first combining character, in case the input ends
+     * before the character they modify. */
+    char const *const combining_src = *src;
+    size_t const combining_srcleft = *srcleft;
+
     /* We use a while loop here because we want to consume any and all combining
      * characters before we go on to return a UCS-4 code point. This is because
      * combining characters come after the code point they modify in Unicode,
@@ -387,91 +594,620 @@ static size_t marc8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
         size_t const initial_srcleft = *srcleft;
         size_t len = *srcleft;
         size_t loc = 0;
-        ucs4_t uni = 0;
-        bool is_combining = true;
+        bib_iconv_code_point_t code_point;
         /* Lookup the next code point from the working character set. */
-        if (!bib_iconv_charset_lookup(&context->working_set,
-                                      len, *src, &loc, &uni, &is_combining)) {
+        working_set_t const *working_set = &context->working_set;
+        union bib_iconv_code_info const info =
+            marc8_lookup_info(working_set, (unsigned char)**src);
+        errno_t const error = bib_iconv_code_walk(working_set->multibyte, info,
+                                                  len, *src, &loc,
+                                                  &code_point);
+        if (error == EINVAL) {
+            /* The input ended in the middle of a multibyte character. Leave it
+             * in the input buffer along with any combining characters that
+             * modify it, so that they can be read again once it's complete. */
+            context->combining_len = 0;
+            *src = combining_src;
+            *srcleft = combining_srcleft;
+            errno = error;
+            return (size_t)-1;
+        }
+        if (error != 0) {
             *src = initial_src;
             *srcleft = initial_srcleft;
+            errno = error;
             return (size_t)-1;
         }
+        ucs4_t const uni = code_point.unicode;
+        bool const is_combining = code_point.is_combining;
         *src += loc;
         *srcleft -= loc;
-        c = **src;
         if (uni == UCS4_IGNORED) {
             /* The character is represented by two code points in MARC-8, but
              * only one code point in Unicode, so we ignore the second code
              * point and go on to read the next code point in the string. */
-            continue;
         } else if (!is_combining) {
             /* The character is not a combining character, so we return it. */
-            *unicode = uni;
+            *unicode = (context->normalization == BIB_ICONV_NORMALIZE_NONE)
+                     ? uni : marc8_normalize(context, uni);
             return 0;
-        }
-        if (context->combining_len >= context->combining_cap) {
-            /* Make sure we resize the combining character array to contain
-             * all combining characters encountered thus far. */
-            /* Assert that there's always room for more than one character in
-             * the combining character array. This is initially set by the
-             * init function with the value of 8, but this debug assert is here
-             * as a sanity check just in case. */
-            assert(context->combining_cap > 1);
-            /* Extend the the combining character array's capacity by half. */
-            context->combining_cap += context->combining_cap / 2;
-            size_t new_size = context->combining_cap * sizeof(ucs4_t);
-            ucs4_t *combiners = realloc(context->combining_chars, new_size);
-            if (combiners == nullptr) {
-                /* We ran out of memory. Exit the function with an error. */
-                *src = initial_src;
-                *srcleft = initial_srcleft;
-                errno = ENOMEM;
+        } else {
+            if (context->combining_len >= MARC8_MAX_COMBINING_CHARS) {
+                /* There are too many combining characters for one character.
+                 * Reject the whole run of them as an invalid sequence. */
+                context->combining_len = 0;
+                *src = combining_src;
+                *srcleft = combining_srcleft;
+                errno = EILSEQ;
                 return (size_t)-1;
             }
-            context->combining_chars = combiners;
+            /* Add the Unicode code point to the end of the combining characters
+             * array. */
+            context->combining_chars[context->combining_len] = uni;
+            context->combining_len += 1;
         }
-        /* Add the Unicode code point to the end of the combining characters
-         * array. */
-        context->combining_chars[context->combining_len] = uni;
-        context->combining_len += 1;
+        if (*srcleft == 0) {
+            /* The input ended before the character that the combining
+             * characters modify. Leave them in the input buffer so that they
+             * can be read again along with the rest of the character. */
+            context->combining_len = 0;
+            *src = combining_src;
+            *srcleft = combining_srcleft;
+            errno = EINVAL;
+            return (size_t)-1;
+        }
+        c = **src;
     }
 
     *unicode = 0;
     return 0;
 }
 
-static size_t marc8_init(bib_iconv_t cd, bib_iconv_decoder_t d,
-                         char const **restrict src, size_t *restrict srcleft) {
+static size_t marc8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
+                         char const **restrict src, size_t *restrict srcleft,
+                         ucs4_t *unicode) {
+    assert(cd != nullptr);
+    assert(d != nullptr);
+    assert(src != nullptr);
+    assert(*src != nullptr);
+    assert(srcleft != nullptr);
+    assert(d->context != nullptr);
+    return marc8_decode((context_t *)d->context, src, srcleft, unicode);
+}
+
+static size_t marc8_read_block(bib_iconv_t cd, bib_iconv_decoder_t d,
+                               char const **restrict src,
+                               size_t *restrict srcleft,
+                               ucs4_t *restrict block, size_t *restrict count) {
+    assert(count != nullptr);
+    size_t const capacity = *count;
+    size_t n = 0;
+    while (n < capacity) {
+        if (marc8_read(cd, d, src, srcleft, &block[n]) == (size_t)-1) {
+            *count = n;
+            return (size_t)-1;
+        }
+        n += 1;
+        if (block[n - 1] == 0) {
+            break;
+        }
+    }
+    *count = n;
+    return 0;
+}
+
+#pragma mark - Fused Converters
+
+/**
+ * Update the range of the decoder's ``context_t/plain_chars`` table for one
+ * code area of its working set.
+ *
+ * - parameter context: The decoder's state, with the current working set.
+ * - parameter first: The first byte in the code area.
+ * - parameter count: The amount of bytes in the code area.
+ * - parameter area: The lookup table of the code element in the code area.
+ */
+static void
+marc8_update_plain_chars(context_t *context, size_t first, size_t count,
+                         union bib_iconv_code_info const area[count]) {
+    ucs4_t *plain_chars = &context->plain_chars[first];
+    for (size_t index = 0; index < count; index += 1) {
+        union bib_iconv_code_info const info = area[index];
+        ucs4_t uni = info.code_point.unicode;
+        bool const is_plain = info.is_final_unit
+                           && !info.code_point.is_combining
+                           && uni != UCS4_NONCHAR
+                           && uni != UCS4_IGNORED;
+        if (is_plain
+            && context->normalization == BIB_ICONV_NORMALIZE_NFC) {
+            uni = bib_iconv_nfc_singleton(uni);
+        }
+        plain_chars[index] = is_plain ? uni : 0;
+    }
+}
+
+/**
+ * Update the decoder's ``context_t/plain_chars`` table for the code areas
+ * changed by escape sequences since it was last updated.
+ *
+ * - parameter context: The decoder's state, with the current working set.
+ */
+static void marc8_update_changed_areas(context_t *context) {
+    if (context->is_g0_changed) {
+        marc8_update_plain_chars(context, 0x20, 96,
+                                 context->working_set.gl->lookup_table);
+        context->is_g0_changed = false;
+    }
+    if (context->is_g1_changed) {
+        marc8_update_plain_chars(context, 0x80, 32,
+                                 context->working_set.cr->lookup_table);
+        marc8_update_plain_chars(context, 0xA0, 96,
+                                 context->working_set.gr->lookup_table);
+        context->is_g1_changed = false;
+    }
+}
+
+/** The Unicode encoding form written by a fused MARC-8 converter. */
+typedef enum marc8_output {
+    marc8_output_utf8,
+    marc8_output_utf16,
+    marc8_output_utf32,
+} marc8_output_t;
+
+/**
+ * Write a Unicode code point to the `dst` buffer in the given encoding form.
+ *
+ * - parameter output: The Unicode encoding form to write.
+ * - parameter c: The UCS-4 Unicode code point to write.
+ * - parameter dst: The destination buffer to write the encoded code point to,
+ *   or `NULL` to only measure the encoded code point.
+ * - parameter dstleft: The amount of bytes left in the `dst` buffer.
+ * - returns: `0` on a successful write, and `(size_t)-1` on a failure.
+ *
+ * This writes exactly the same bytes as the UTF-8, UTF-16, and UTF-32 encoders.
+ */
+static inline size_t marc8_emit(marc8_output_t output, ucs4_t c,
+                                char **restrict dst, size_t *restrict dstleft) {
+    size_t size = 0;
+    switch (output) {
+        case marc8_output_utf8:
+            size = (c <= 0x7F) ? 1 : (c <= 0x7FF) ? 2 : (c <= 0xFFFF) ? 3 : 4;
+            break;
+        case marc8_output_utf16:
+            size = (c <= 0xFFFF) ? 2 : 4;
+            break;
+        case marc8_output_utf32:
+            size = 4;
+            break;
+    }
+    if (output != marc8_output_utf32 && c > 0x10FFFF) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    if (*dstleft < size) {
+        errno = E2BIG;
+        return (size_t)-1;
+    }
+    if (output == marc8_output_utf32
+        && (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))) {
+        errno = EILSEQ;
+        return (size_t)-1;
+    }
+    if (dst == nullptr) {
+        *dstleft -= size;
+        return 0;
+    }
+    switch (output) {
+        case marc8_output_utf8: {
+            char8_t *out = (char8_t *)*dst;
+            if (size == 1) {
+                out[0] = (char8_t)c;
+            } else if (size == 2) {
+                out[0] = (char8_t)(0xC0 | (c >> 6));
+                out[1] = (char8_t)(0x80 | (c & 0x3F));
+            } else if (size == 3) {
+                out[0] = (char8_t)(0xE0 | (c >> 12));
+                out[1] = (char8_t)(0x80 | ((c >> 6) & 0x3F));
+                out[2] = (char8_t)(0x80 | (c & 0x3F));
+            } else {
+                out[0] = (char8_t)(0xF0 | (c >> 18));
+                out[1] = (char8_t)(0x80 | ((c >> 12) & 0x3F));
+                out[2] = (char8_t)(0x80 | ((c >> 6) & 0x3F));
+                out[3] = (char8_t)(0x80 | (c & 0x3F));
+            }
+            break;
+        }
+        case marc8_output_utf16:
+            if (size == 2) {
+                ((char16_t *)(*dst))[0] = (char16_t)c;
+            } else {
+                c -= 0x10000;
+                ((char16_t *)(*dst))[0] = (char16_t)(0xD800 | (c >> 10));
+                ((char16_t *)(*dst))[1] = (char16_t)(0xDC00 | (c & 0x3FF));
+            }
+            break;
+        case marc8_output_utf32:
+            *(char32_t *)(*dst) = (char32_t)c;
+            break;
+    }
+    *dst += size;
+    *dstleft -= size;
+    return 0;
+}
+
+/**
+ * Convert MARC-8 encoded text directly into a Unicode encoding form.
+ *
+ * - parameter d: The MARC-8 decoder, whose context holds the working set.
+ * - parameter output: The Unicode encoding form to write. This is always a
+ *   constant, so each fused converter gets its own specialized copy of this
+ *   function.
+ * - parameter src: The source buffer to read MARC-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the `src` buffer.
+ * - parameter dst: The destination buffer to write the converted text to.
+ * - parameter dstleft: The amount of bytes left in the `dst` buffer.
+ * - parameter pending: The location to store a code point that was read from
+ *   the `src` buffer, but couldn't be written to the `dst` buffer.
+ * - parameter has_pending: Set to `true` when `pending` is set.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * When `dst` is `NULL`, nothing is written and `dstleft` is only decreased by
+ * the size of each converted character, to measure the converted text.
+ *
+ * Runs of ASCII characters, including MARC's terminators and delimiters, are
+ * copied or widened as a whole while the G0 graphic set is Basic Latin. Runs
+ * of other single-byte characters that are neither combining characters nor
+ * escape sequences are mapped as a whole through ``context_t/plain_chars``
+ * into UTF-16 and UTF-32, and one at a time into UTF-8. Every other
+ * character goes through ``marc8_decode``, so conversion stops at the same
+ * place and with the same error as the generic conversion path.
+ */
+static inline size_t marc8_convert(bib_iconv_decoder_t d,
+                                   marc8_output_t output,
+                                   char const **restrict src,
+                                   size_t *restrict srcleft,
+                                   char **restrict dst,
+                                   size_t *restrict dstleft,
+                                   ucs4_t *restrict pending,
+                                   bool *restrict has_pending) {
+    assert(d != nullptr);
+    assert(d->context != nullptr);
     context_t *context = (context_t *)d->context;
-    if (context == nullptr) {
-        context = calloc(1, sizeof(context_t));
-        d->context = context;
+    size_t const unit_size = (output == marc8_output_utf8) ? 1
+                           : (output == marc8_output_utf16) ? 2 : 4;
+    struct bib_iconv_graphic_set const *const basic_latin
+        = &bib_iconv_marc8_basic_latin.code_table.code_areas.gl;
+    while (true) {
+        /* Indicates that the plain characters table matches the working set,
+         * so that the faster paths through it can be used. */
+        bool is_current = true;
+        if (context->is_g0_changed || context->is_g1_changed) {
+            if (context->reads_since_shift < MARC8_SHIFT_READS) {
+                context->reads_since_shift += 1;
+                is_current = false;
+            } else {
+                marc8_update_changed_areas(context);
+            }
+        }
+        if (context->working_set.gl == basic_latin
+            && context->combining_len == 0) {
+            /* ASCII characters from the record terminator up map to
+             * themselves, and are never combining characters. This only
+             * depends on the G0 graphic set, so it doesn't wait for the plain
+             * characters table to catch up with an escape sequence. Stop the
+             * run where the destination buffer fills up, just like writing the
+             * characters one at a time. */
+            size_t length = *dstleft / unit_size;
+            if (length > *srcleft) {
+                length = *srcleft;
+            }
+            size_t const run = bib_iconv_scan_marc8_ascii(*src, length);
+            if (run > 0 && dst == nullptr) {
+                /* Only count the run's characters. */
+                *src += run;
+                *srcleft -= run;
+                *dstleft -= run * unit_size;
+            } else if (run > 0) {
+                switch (output) {
+                    case marc8_output_utf8:
+                        memcpy(*dst, *src, run);
+                        break;
+                    case marc8_output_utf16:
+                        bib_iconv_widen_utf16(*dst, *src, run);
+                        break;
+                    case marc8_output_utf32:
+                        bib_iconv_widen_utf32(*dst, *src, run);
+                        break;
+                }
+                *src += run;
+                *srcleft -= run;
+                *dst += run * unit_size;
+                *dstleft -= run * unit_size;
+                if (*dstleft == 0) {
+                    return 0;
+                }
+            }
+        }
+        if (is_current && output != marc8_output_utf8 && dst != nullptr
+            && context->combining_len == 0) {
+            /* Map single-byte characters from any of the working set's
+             * graphic sets, up until the next escape sequence, multibyte
+             * character, or combining character. */
+            size_t length = *dstleft / unit_size;
+            if (length > *srcleft) {
+                length = *srcleft;
+            }
+            size_t const run = (output == marc8_output_utf16)
+                ? bib_iconv_map_utf16(*dst, *src, length, context->plain_chars)
+                : bib_iconv_map_utf32(*dst, *src, length, context->plain_chars);
+            if (run > 0) {
+                *src += run;
+                *srcleft -= run;
+                *dst += run * unit_size;
+                *dstleft -= run * unit_size;
+                if (*dstleft == 0) {
+                    return 0;
+                }
+            }
+        }
+
+        ucs4_t uni = 0;
+        unsigned char c = (*srcleft > 0) ? **src : 0;
+        if (is_current && context->combining_len == 0
+            && context->plain_chars[c] != 0) {
+            uni = context->plain_chars[c];
+            *src += 1;
+            *srcleft -= 1;
+        } else if (marc8_decode(context, src, srcleft, &uni) == (size_t)-1) {
+            return (size_t)-1;
+        }
+        if (marc8_emit(output, uni, dst, dstleft) == (size_t)-1) {
+            *pending = uni;
+            *has_pending = true;
+            return (size_t)-1;
+        }
+        if (uni == 0 || *dstleft == 0) {
+            return 0;
+        }
     }
+}
+
+size_t bib_iconv_convert_marc8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                       char const **restrict src,
+                                       size_t *restrict srcleft,
+                                       char **restrict dst,
+                                       size_t *restrict dstleft,
+                                       ucs4_t *restrict pending,
+                                       bool *restrict has_pending) {
+    (void)cd;
+    return marc8_convert(d, marc8_output_utf8, src, srcleft, dst, dstleft,
+                         pending, has_pending);
+}
+
+size_t bib_iconv_convert_marc8_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending) {
+    (void)cd;
+    return marc8_convert(d, marc8_output_utf16, src, srcleft, dst, dstleft,
+                         pending, has_pending);
+}
+
+size_t bib_iconv_convert_marc8_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending) {
+    (void)cd;
+    return marc8_convert(d, marc8_output_utf32, src, srcleft, dst, dstleft,
+                         pending, has_pending);
+}
+
+/**
+ * Measure the converted size of MARC-8 encoded text in a Unicode encoding form.
+ *
+ * - parameter d: The MARC-8 decoder holding the conversion state.
+ * - parameter output: The Unicode encoding form to measure.
+ * - parameter src: The source buffer to read MARC-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the input buffer to read.
+ * - parameter size: The location to store the amount of bytes that converting
+ *   the text would write, up to any error.
+ * - returns: `0` upon a successful measurement, and `(size_t)-1` on failure.
+ */
+static inline size_t marc8_measure(bib_iconv_decoder_t d,
+                                   marc8_output_t output,
+                                   char const **restrict src,
+                                   size_t *restrict srcleft,
+                                   size_t *restrict size) {
+    size_t dstleft = SIZE_MAX;
+    ucs4_t pending = 0;
+    bool has_pending = false;
+    size_t const result = marc8_convert(d, output, src, srcleft, nullptr,
+                                        &dstleft, &pending, &has_pending);
+    *size = SIZE_MAX - dstleft;
+    return result;
+}
+
+size_t bib_iconv_measure_marc8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                       char const **restrict src,
+                                       size_t *restrict srcleft,
+                                       size_t *restrict size) {
+    (void)cd;
+    return marc8_measure(d, marc8_output_utf8, src, srcleft, size);
+}
+
+size_t bib_iconv_measure_marc8_to_utf16(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size) {
+    (void)cd;
+    return marc8_measure(d, marc8_output_utf16, src, srcleft, size);
+}
+
+size_t bib_iconv_measure_marc8_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size) {
+    (void)cd;
+    return marc8_measure(d, marc8_output_utf32, src, srcleft, size);
+}
+
+#pragma mark - Decoder
+
+/**
+ * Shift the working set back into the character sets that MARC-8 decoding
+ * always begins with, and drop any combining characters.
+ *
+ * - parameter context: The decoder's state.
+ *
+ * Only the code areas that differ from the initial character sets are
+ * updated in ``context_t/plain_chars``, so resetting a decoder between records
+ * costs a few stores when the last record ended in the initial working set.
+ */
+static void marc8_reset(context_t *context) {
     /* MARC-8 always begins decoding with the ASCII and ASNEL character sets in
      * the working set. */
-    context->working_set.code_table.code_areas.cl =
-        bib_iconv_marc8_basic_latin.code_table.code_areas.cl;
-    context->working_set.code_table.code_areas.gl =
-        bib_iconv_marc8_basic_latin.code_table.code_areas.gl;
-    context->working_set.code_table.code_areas.cr =
-        bib_iconv_marc8_extended_latin.code_table.code_areas.cr;
-    context->working_set.code_table.code_areas.gr =
-        bib_iconv_marc8_extended_latin.code_table.code_areas.gr;
-    context->working_set.code_spans = bib_iconv_marc8_eacc.code_spans;
-    context->combining_cap = 8;
+    marc8_shift_g0(context, &bib_iconv_marc8_basic_latin);
+    marc8_shift_g1(context, &bib_iconv_marc8_extended_latin);
+    context->working_set.multibyte = &bib_iconv_marc8_eacc;
     context->combining_len = 0;
-    context->combining_chars = calloc(context->combining_cap, sizeof(ucs4_t));
+    marc8_update_changed_areas(context);
+}
+
+/**
+ * Set up the MARC-8 decoder's state with the initial working set and a
+ * complete ``context_t/plain_chars`` table.
+ *
+ * - parameter context: The zero-filled memory for the decoder's state.
+ */
+static void marc8_setup_context(context_t *context) {
+    context->working_set = (working_set_t){
+        .cl = &bib_iconv_marc8_basic_latin.code_table.code_areas.cl,
+        .gl = &bib_iconv_marc8_basic_latin.code_table.code_areas.gl,
+        .cr = &bib_iconv_marc8_extended_latin.code_table.code_areas.cr,
+        .gr = &bib_iconv_marc8_extended_latin.code_table.code_areas.gr,
+        .multibyte = &bib_iconv_marc8_eacc,
+    };
+    working_set_t const *working_set = &context->working_set;
+    marc8_update_plain_chars(context, 0x00, 32, working_set->cl->lookup_table);
+    marc8_update_plain_chars(context, 0x20, 96, working_set->gl->lookup_table);
+    marc8_update_plain_chars(context, 0x80, 32, working_set->cr->lookup_table);
+    marc8_update_plain_chars(context, 0xA0, 96, working_set->gr->lookup_table);
+    /* The null character and the escape character are never plain. */
+    context->plain_chars[0x00] = 0;
+    context->plain_chars[ESCAPE_CHAR] = 0;
+}
+
+static size_t marc8_init(bib_iconv_t cd, bib_iconv_decoder_t d,
+                         char const **restrict src, size_t *restrict srcleft) {
+    context_t *context = (context_t *)d->context;
+    if (context->working_set.cl == nullptr) {
+        /* The context is only set up the first time the decoder is
+         * initialized, and is reused after every flush or reset. */
+        marc8_setup_context(context);
+        return 0;
+    }
+    marc8_reset(context);
     return 0;
 }
 
-static void marc8_deinit(bib_iconv_decoder_t d) {
+static size_t marc8_init_ordered(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                 char const **restrict src,
+                                 size_t *restrict srcleft) {
     context_t *context = (context_t *)d->context;
-    free(context->combining_chars);
-    free(context);
+    context->normalization = BIB_ICONV_NORMALIZE_ORDER;
+    return marc8_init(cd, d, src, srcleft);
+}
+
+static size_t marc8_init_nfc(bib_iconv_t cd, bib_iconv_decoder_t d,
+                             char const **restrict src,
+                             size_t *restrict srcleft) {
+    context_t *context = (context_t *)d->context;
+    context->normalization = BIB_ICONV_NORMALIZE_NFC;
+    return marc8_init(cd, d, src, srcleft);
+}
+
+/**
+ * Find the escape sequence identifier of the character set with a graphic
+ * set in the working set.
+ *
+ * - parameter set: The graphic set in the G0 or G1 area of the working set.
+ * - returns: The identifier of the character set containing `set`.
+ */
+static marc8_escape_charset_t
+marc8_graphic_set_id(struct bib_iconv_graphic_set const *set) {
+    size_t const count = sizeof(marc8_escape_charsets)
+                       / sizeof(marc8_escape_charsets[0]);
+    for (size_t id = 0; id < count; id += 1) {
+        struct bib_iconv_code_areas const *areas =
+            &marc8_escape_charsets[id]->code_table.code_areas;
+        if (set == &areas->gl || set == &areas->gr) {
+            return (marc8_escape_charset_t)id;
+        }
+    }
+    assert(false && "The working set only holds MARC-8 character sets.");
+    return escape_basic_latin;
+}
+
+static void marc8_save(bib_iconv_decoder_t d,
+                       bib_iconv_shift_state_t *restrict state) {
+    context_t const *context = (context_t const *)d->context;
+    assert(context->combining_len == 0);
+    working_set_t const *working_set = &context->working_set;
+    size_t const count = sizeof(marc8_escape_charsets)
+                       / sizeof(marc8_escape_charsets[0]);
+    marc8_escape_charset_t multibyte = escape_eacc;
+    for (size_t id = 0; id < count; id += 1) {
+        if (marc8_escape_charsets[id] == working_set->multibyte) {
+            multibyte = (marc8_escape_charset_t)id;
+        }
+    }
+    *state = (bib_iconv_shift_state_t){
+        .charsets = {
+            marc8_graphic_set_id(working_set->gl),
+            marc8_graphic_set_id(working_set->gr),
+            multibyte,
+        },
+    };
+}
+
+static void marc8_restore(bib_iconv_decoder_t d,
+                          bib_iconv_shift_state_t const *restrict state) {
+    context_t *context = (context_t *)d->context;
+    marc8_shift_g0(context, marc8_escape_charsets[state->charsets[0]]);
+    marc8_shift_g1(context, marc8_escape_charsets[state->charsets[1]]);
+    context->working_set.multibyte = marc8_escape_charsets[state->charsets[2]];
+    context->combining_len = 0;
+    marc8_update_changed_areas(context);
 }
 
 void bib_iconv_open_marc8_decoder(bib_iconv_decoder_t d) {
+    d->context_size = sizeof(context_t);
     d->init = marc8_init;
     d->read = marc8_read;
-    d->deinit = marc8_deinit;
+    d->read_block = marc8_read_block;
+    d->save = marc8_save;
+    d->restore = marc8_restore;
+    d->deinit = nullfun;
+}
+
+void bib_iconv_open_marc8_normalizing_decoder(bib_iconv_decoder_t d,
+                                              bib_iconv_normalization_t
+                                                  normalization) {
+    bib_iconv_open_marc8_decoder(d);
+    switch (normalization) {
+        case BIB_ICONV_NORMALIZE_NONE:
+            break;
+        case BIB_ICONV_NORMALIZE_ORDER:
+            d->init = marc8_init_ordered;
+            break;
+        case BIB_ICONV_NORMALIZE_NFC:
+            d->init = marc8_init_nfc;
+            break;
+    }
 }
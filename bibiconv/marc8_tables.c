@@ -49,7 +49,7 @@ struct bib_iconv_charset const bib_iconv_marc8_basic_latin =
     R(NNNNNNNN, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F),
     R(NNNNNNNN, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077),
     R(NNNNNNNN, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Extended Latin
 
@@ -94,7 +94,7 @@ struct bib_iconv_charset const bib_iconv_marc8_extended_latin =
     R(CCCCNCCC, 0x0308, 0x030C, 0x030A, 0x0361, IGNORE, 0x0315, 0x030B, 0x0310),
     R(CCCCCCCC, 0x0327, 0x0328, 0x0323, 0x0324, 0x0325, 0x0333, 0x0332, 0x0326),
     R(CCCNNNCN, 0x031C, 0x032E, 0x0360, IGNORE, NONCHR, NONCHR, 0x0313, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Greek Symbols
 
@@ -139,7 +139,7 @@ struct bib_iconv_charset const bib_iconv_marc8_greek_symbols =
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Subscript
 
@@ -184,7 +184,7 @@ struct bib_iconv_charset const bib_iconv_marc8_subscript =
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Superscript
 
@@ -229,7 +229,7 @@ struct bib_iconv_charset const bib_iconv_marc8_superscript =
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Basic Hebrew
 
@@ -274,7 +274,7 @@ struct bib_iconv_charset const bib_iconv_marc8_basic_hebrew =
     R(NNNNNNNN, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF),
     R(NNNNNNNN, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7),
     R(NNNNNNNN, 0x05E8, 0x05E9, 0x05EA, 0x05F0, 0x05F1, 0x05F2, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Basic Cyrillic
 
@@ -319,7 +319,7 @@ struct bib_iconv_charset const bib_iconv_marc8_basic_cyrillic =
     R(NNNNNNNN, 0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E),
     R(NNNNNNNN, 0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412),
     R(NNNNNNNN, 0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Extended Cyrillic
 
@@ -364,7 +364,7 @@ struct bib_iconv_charset const bib_iconv_marc8_extended_cyrillic =
     R(NNNNNNNN, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040E, 0x040F, 0x042A),
     R(NNNNNNNN, 0x0462, 0x0472, 0x0474, 0x046A, NONCHR, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Basic Arabic
 
@@ -409,7 +409,7 @@ struct bib_iconv_charset const bib_iconv_marc8_basic_arabic =
     R(NNNCCCCC, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F),
     R(CCCNNNNN, 0x0650, 0x0651, 0x0652, 0x0671, 0x0670, NONCHR, NONCHR, NONCHR),
     R(NNNNNNNN, 0x066C, 0x201D, 0x201C, NONCHR, NONCHR, NONCHR, NONCHR, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Extended Arabic
 
@@ -454,7 +454,7 @@ struct bib_iconv_charset const bib_iconv_marc8_extended_arabic =
     R(NNNNNNNN, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x06B9, 0x06BE, 0x06C0, 0x06C4),
     R(NNNNNNNN, 0x06C5, 0x06C6, 0x06CA, 0x06CB, 0x06CD, 0x06CE, 0x06D0, 0x06D2),
     R(NNNNNCCN, 0x06D3, NONCHR, NONCHR, NONCHR, NONCHR, 0x0306, 0x030C, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - Basic Greek
 
@@ -499,7 +499,7 @@ struct bib_iconv_charset const bib_iconv_marc8_basic_greek =
     R(NNNNNNNN, 0x03DD, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC),
     R(NNNNNNNN, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03DF, 0x03C1, 0x03C3, 0x03C2),
     R(NNNNNNNN, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03E1, NONCHR),
-}}, NULL };
+}}, NULL, NULL };
 
 #pragma mark - East Asian Characters
 
@@ -12982,4 +12982,2021 @@ struct bib_iconv_charset const bib_iconv_marc8_eacc =
     { 0x71, { .code_point = { 1, 0, 0x9EE2 } } },
     { 0x00, { 0 } },
 }},
+}, (struct bib_iconv_code_occupancy const []){
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x21 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2123 = */
+    { { 0x00002303, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x212A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x212B = */
+    { { 0x2F3E0060, 0x02000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x212F = */
+    { { 0x00010000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2130 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2131 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2132 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2133 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2134 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2135 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2136 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2137 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2138 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2139 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x213F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2140 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2141 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2142 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2143 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2144 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2145 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2146 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2147 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2148 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2149 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x214F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2150 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2151 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2152 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2153 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2154 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2155 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2156 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2157 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2158 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2159 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x215F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2160 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2161 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2162 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2163 = */
+    { { 0x00013FFE, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2164 = */
+    { { 0x909A4230, 0x45270040, 0x102C080E } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2165 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2166 = */
+    { { 0x48A816C4, 0x4A047348, 0x02000246 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2167 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2168 = */
+    { { 0x1C345004, 0x88200056, 0x430627E2 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2169 = */
+    { { 0x40010A00, 0x13660191, 0x18234280 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216A = */
+    { { 0x0020004C, 0x0010C048, 0x03080148 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216B = */
+    { { 0x42C80450, 0xC8093888, 0x16300800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216D = */
+    { { 0x44484038, 0x21885806, 0x0C1020D0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216E = */
+    { { 0x40005000, 0x01800100, 0x2341B102 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x216F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2170 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2171 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2172 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2173 = */
+    { { 0x40F40120, 0x0C085826, 0x42E1AC85 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2174 = */
+    { { 0x06E77392, 0x0000110E, 0x06A10728 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2175 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2176 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2177 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2178 = */
+    { { 0x04054810, 0x44511A02, 0x14191000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2179 = */
+    { { 0x01090900, 0x00308808, 0x10028A20 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x217A = */
+    { { 0x44201532, 0xE0478018, 0x41204002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x217B = */
+    { { 0x7C021000, 0x00040302, 0x00220620 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x217C = */
+    { { 0x427303F6, 0x0A058622, 0x18046001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x217D = */
+    { { 0x61004C40, 0x02040181, 0x10504008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x217E = */
+    { { 0x003705BA, 0x0A240209, 0x42204501 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x22 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2222 = */
+    { { 0x10280030, 0x08040940, 0x1A0000A8 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2223 = */
+    { { 0x1A830A08, 0x10A02A41, 0x0301B8C3 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2224 = */
+    { { 0x18130B40, 0x259D0642, 0x00D60200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2225 = */
+    { { 0x8612B1E0, 0x04032610, 0x48A80741 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2226 = */
+    { { 0x4055C440, 0x004540D0, 0x0DCC0014 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2227 = */
+    { { 0x82600014, 0xA1800180, 0x40802039 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2228 = */
+    { { 0x00608000, 0x9CA21804, 0x10022103 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2229 = */
+    { { 0x0420000A, 0x91063C00, 0x131F1704 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222A = */
+    { { 0x22100888, 0x80810040, 0x090C018A } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222B = */
+    { { 0x31C33410, 0xC4890860, 0x04568100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222C = */
+    { { 0x4415B810, 0x205A41C4, 0x302942C5 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222D = */
+    { { 0x88941400, 0x4943450A, 0x0A9109C2 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222E = */
+    { { 0x200CB008, 0x342410ED, 0x60820500 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x222F = */
+    { { 0x20000200, 0x2840009A, 0x17A1C282 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2230 = */
+    { { 0x00063940, 0x00C0084A, 0x00040602 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2231 = */
+    { { 0x04860020, 0x9D1007B4, 0x2A0C5D00 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2232 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2233 = */
+    { { 0x2BC29A14, 0x2A0A1130, 0x09409500 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2234 = */
+    { { 0x90005198, 0x08106004, 0x00301466 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2235 = */
+    { { 0x014A6400, 0x0A088844, 0x1084A202 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2236 = */
+    { { 0xC0501000, 0x001080A0, 0x04A34010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2237 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2238 = */
+    { { 0xE0061980, 0x04033700, 0x36670141 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2239 = */
+    { { 0x04050410, 0x1430C08B, 0x114E0001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223A = */
+    { { 0x031B0100, 0x19005080, 0x152249C3 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x223F = */
+    { { 0x6CA42022, 0x16030070, 0x45A02523 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2240 = */
+    { { 0x61106080, 0xC8D13842, 0x10644191 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2241 = */
+    { { 0x9E800318, 0x014A8CEF, 0x42A83000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2242 = */
+    { { 0x00F00C5C, 0x20A20E84, 0x42000110 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2243 = */
+    { { 0x86B80120, 0x83054131, 0x40046083 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2244 = */
+    { { 0xDDA43400, 0xA81A5440, 0x0A0A0802 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2245 = */
+    { { 0xAB600220, 0x08102080, 0x0003802D } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2246 = */
+    { { 0x01881400, 0x5E061514, 0x1D1103D5 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2247 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2248 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2249 = */
+    { { 0x5A30D360, 0x16009949, 0x0A027C01 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224A = */
+    { { 0x22642400, 0x01211450, 0x00922C45 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224D = */
+    { { 0x36A18898, 0x85002810, 0x3218010C } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224E = */
+    { { 0x10A5E062, 0x60C1001F, 0x000404C4 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x224F = */
+    { { 0x06228850, 0x201A0012, 0x390A0A82 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2250 = */
+    { { 0x0A0003A2, 0x12C00705, 0x390F810C } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2251 = */
+    { { 0xBD00494C, 0x10611514, 0x0030F1C1 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2252 = */
+    { { 0x08245180, 0x76F60108, 0x19410AE5 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2253 = */
+    { { 0xD24C1808, 0x02A644C4, 0x14A5A680 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2254 = */
+    { { 0xA4440656, 0x58408880, 0x22024243 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2255 = */
+    { { 0x00000602, 0x024E801A, 0x1012294A } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2256 = */
+    { { 0x00000104, 0x0946D100, 0x4248D091 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2257 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2258 = */
+    { { 0x89408A22, 0x200631C4, 0x20018D8C } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2259 = */
+    { { 0x95658D82, 0x541004A0, 0x050356C8 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225B = */
+    { { 0xD1012586, 0x22F02029, 0x044056C3 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225C = */
+    { { 0x25070320, 0x15150083, 0x208200CA } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225D = */
+    { { 0x020C3120, 0x87A6A214, 0x42226A85 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225E = */
+    { { 0x48A27020, 0xD10344D8, 0x440E00C8 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x225F = */
+    { { 0xD800F206, 0xD0131181, 0x0C20C785 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2260 = */
+    { { 0x05A40814, 0xA2240503, 0x009024E0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2261 = */
+    { { 0x18000048, 0x42198911, 0x00F0B00D } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2262 = */
+    { { 0x64AE2064, 0xA0448034, 0x246C0441 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2263 = */
+    { { 0x04201A08, 0x16248060, 0x011B0181 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2264 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2265 = */
+    { { 0x4A06B200, 0x4560411B, 0x42C8C501 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2266 = */
+    { { 0x00344A86, 0x20213048, 0x3EA00DA1 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2267 = */
+    { { 0x4001240A, 0x9031EC00, 0x0C234013 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2268 = */
+    { { 0x6004652C, 0x10118134, 0x40429802 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2269 = */
+    { { 0xE2000004, 0x8080A001, 0x45210A40 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226A = */
+    { { 0xF4425900, 0x44368A08, 0x10400840 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226C = */
+    { { 0x053822C0, 0x1704015A, 0x00008001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226D = */
+    { { 0x48A4C214, 0x9C1088C2, 0x0020014E } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226E = */
+    { { 0x08310480, 0x5BD00040, 0x26208006 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x226F = */
+    { { 0x4C001702, 0xC310176D, 0x08A2A350 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2270 = */
+    { { 0x02214104, 0x06070634, 0x54029526 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2271 = */
+    { { 0x2A911A04, 0x0F10A914, 0x2110CE86 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2272 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2273 = */
+    { { 0x0098A142, 0x6B064300, 0x001B2C11 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2274 = */
+    { { 0xC006C9A0, 0x40BB00A8, 0x44041C09 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2275 = */
+    { { 0x98081018, 0x00821405, 0x048C9180 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2276 = */
+    { { 0x6AFA5600, 0x2800F800, 0x48010A01 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2277 = */
+    { { 0xC2040100, 0x10004280, 0x28280703 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2278 = */
+    { { 0x1119A480, 0x00310A07, 0x30802653 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2279 = */
+    { { 0x18044020, 0x020629C2, 0x70A10C00 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x227A = */
+    { { 0x0F88D000, 0x08C8880B, 0x00B50121 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x227B = */
+    { { 0x0474C280, 0x40C90DAC, 0x20808884 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x227C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x227D = */
+    { { 0x88204A56, 0x815C2501, 0x54442084 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x227E = */
+    { { 0x0188886E, 0x06CE002A, 0x2A162C0B } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x23 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2322 = */
+    { { 0x10415628, 0x90007508, 0x19024244 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2323 = */
+    { { 0x94E46210, 0xD1490220, 0x16270100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2324 = */
+    { { 0x842C0282, 0x920020C2, 0x34A40440 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2325 = */
+    { { 0x0070E410, 0xF400E840, 0x00D23810 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2326 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2327 = */
+    { { 0x02025110, 0x48945028, 0x00220101 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2328 = */
+    { { 0xC1040044, 0x46001001, 0x59020640 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2329 = */
+    { { 0x32C0C0E0, 0x03000945, 0x4492C08D } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232B = */
+    { { 0x24296192, 0x21381120, 0x4104C041 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232C = */
+    { { 0x86D31010, 0xB0A1B380, 0x040C0C5A } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232D = */
+    { { 0x10044408, 0xC6CA0816, 0x72226200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232E = */
+    { { 0x2C108500, 0x46928721, 0x05260115 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x232F = */
+    { { 0x20E0A01A, 0x24DAC0A8, 0x0C048041 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2330 = */
+    { { 0x1C82323A, 0x00280606, 0x22408854 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2331 = */
+    { { 0x8C049C00, 0x510830A8, 0x240F7811 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2332 = */
+    { { 0x1A8105A0, 0x63418005, 0x40028200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2333 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2334 = */
+    { { 0x05012404, 0x8200A714, 0x0B090900 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2335 = */
+    { { 0x24806048, 0x10752830, 0x281AA028 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2336 = */
+    { { 0x02006400, 0xC08E401A, 0x58558580 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2337 = */
+    { { 0x6E042862, 0x10040100, 0x00220002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2338 = */
+    { { 0x00088004, 0x06040000, 0x000FC040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2339 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233B = */
+    { { 0x800AC000, 0x0E428804, 0x27206818 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233C = */
+    { { 0x200B20C0, 0x06887B00, 0x2CB17060 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233D = */
+    { { 0x90218006, 0x2BC04731, 0x09300480 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233E = */
+    { { 0x84901562, 0xAB120119, 0x03248502 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x233F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2340 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2341 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2342 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2343 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2344 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2345 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2346 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2347 = */
+    { { 0x38159000, 0x33236200, 0x12128685 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2348 = */
+    { { 0x61E52980, 0x71880405, 0x18023304 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2349 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234A = */
+    { { 0x10058002, 0x60020C54, 0x0600702C } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234B = */
+    { { 0x58A08000, 0x008C0300, 0x05D200D0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234C = */
+    { { 0x61000684, 0x11054680, 0x29605C00 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234D = */
+    { { 0x15A71020, 0x16100209, 0x15130404 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234E = */
+    { { 0x09202250, 0x521A5808, 0x4A081001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x234F = */
+    { { 0x21903048, 0x00004831, 0x40848C45 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2350 = */
+    { { 0x02030206, 0x80086501, 0x0000110B } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2351 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2352 = */
+    { { 0x58018A04, 0x0018E206, 0x1C10022A } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2353 = */
+    { { 0xE0030610, 0x0604B1B0, 0x66110613 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2354 = */
+    { { 0x84181494, 0x2691122A, 0x00D42440 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2355 = */
+    { { 0x59640582, 0x4050C08A, 0x20581040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2356 = */
+    { { 0x5440000C, 0x20000082, 0x0C0C0008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2357 = */
+    { { 0xB246CA02, 0xE240420C, 0x14845840 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2358 = */
+    { { 0x4012B888, 0x12143A18, 0x43034240 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2359 = */
+    { { 0x09150760, 0x59608220, 0x00980800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235A = */
+    { { 0x8001911E, 0x00088110, 0x08210B28 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235B = */
+    { { 0x8020D440, 0x4204A084, 0x5ED10CC1 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235C = */
+    { { 0x44540184, 0x98808060, 0x40023420 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235D = */
+    { { 0x1EC00880, 0x35208B8C, 0x06800040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235E = */
+    { { 0x00A10000, 0x12A81404, 0x3CD08041 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x235F = */
+    { { 0x009E8000, 0xC0080320, 0x5A0AA210 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2360 = */
+    { { 0x80000108, 0x08000081, 0x00060806 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x27 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2730 = */
+    { { 0x00040000, 0x01003000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2731 = */
+    { { 0x11000000, 0x20009000, 0x02081200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2732 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2733 = */
+    { { 0x00000008, 0x00000101, 0x51412800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2734 = */
+    { { 0x31F8800E, 0x80260000, 0x2C000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2735 = */
+    { { 0x00000800, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2736 = */
+    { { 0x40000000, 0x00000300, 0x0502A108 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2737 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2738 = */
+    { { 0x48000000, 0x0E602430, 0x00D2FA97 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2739 = */
+    { { 0x80004018, 0x00080003, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273A = */
+    { { 0x08400180, 0x88000D3A, 0x00000009 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273B = */
+    { { 0x83E64000, 0x0000101D, 0x0210400B } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273C = */
+    { { 0x000E6D00, 0x510E8000, 0x40C00883 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273D = */
+    { { 0x0000FC80, 0x0000B880, 0x005090A0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273E = */
+    { { 0x00000000, 0x50800000, 0x40811002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x273F = */
+    { { 0xDF4A4B00, 0x1B704DB6, 0x0000C000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2740 = */
+    { { 0x00000000, 0x00000000, 0x68001000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2741 = */
+    { { 0x90400008, 0x8C288004, 0x74D24161 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2742 = */
+    { { 0x0DBBDF74, 0x00D48080, 0x00000048 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2743 = */
+    { { 0x00042000, 0x04202B1B, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2744 = */
+    { { 0x00000040, 0x00000000, 0x14426308 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2745 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2746 = */
+    { { 0x19E80E02, 0x01200001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2747 = */
+    { { 0x00000000, 0x02004000, 0x20900100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2748 = */
+    { { 0x200B2000, 0x87B08916, 0x1902F038 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2749 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274A = */
+    { { 0x01CB4076, 0x44081064, 0x42050106 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274B = */
+    { { 0x0000FF8C, 0xC0800080, 0x04100B90 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274C = */
+    { { 0x1A5A2000, 0x00400000, 0x0BEA640F } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274D = */
+    { { 0xF4002200, 0x20C00000, 0x10080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274E = */
+    { { 0x48000080, 0x7F081220, 0x39808000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x274F = */
+    { { 0x30400024, 0xB0001E51, 0x0201081F } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2750 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2751 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2752 = */
+    { { 0x01B8001E, 0x01022004, 0x0FF28000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2753 = */
+    { { 0x00000002, 0x43002410, 0x7F025024 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2754 = */
+    { { 0x003C0826, 0x11004C00, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2755 = */
+    { { 0x10002700, 0x202AA002, 0x104A5198 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2756 = */
+    { { 0x7EA64654, 0x04001595, 0x06400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2757 = */
+    { { 0xD07C1030, 0x000006C6, 0x328A102C } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2758 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2759 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275C = */
+    { { 0x56180000, 0x3CCF8330, 0x003B2800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x275F = */
+    { { 0x7E805C18, 0x0031FC00, 0x0200E880 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2760 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2761 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2762 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2763 = */
+    { { 0x00003FF6, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2766 = */
+    { { 0x00000000, 0x00000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2767 = */
+    { { 0x00000000, 0x00000000, 0x10200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2768 = */
+    { { 0x00000004, 0x00000004, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2769 = */
+    { { 0x00000000, 0x00000110, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x276B = */
+    { { 0x40000000, 0x88000000, 0x06000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x276D = */
+    { { 0x00004000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x276E = */
+    { { 0x00000400, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x276F = */
+    { { 0x00000000, 0x00000000, 0x00000200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2770 = */
+    { { 0x00010000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2771 = */
+    { { 0x00000000, 0x00000000, 0x00000200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2772 = */
+    { { 0x02100000, 0x01200000, 0x44040080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2773 = */
+    { { 0x00000100, 0x04001020, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2774 = */
+    { { 0x00004000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2776 = */
+    { { 0x01000000, 0x00000000, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2777 = */
+    { { 0x00000000, 0x00000124, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2778 = */
+    { { 0x00000000, 0x44000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2779 = */
+    { { 0x00000000, 0x00100000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x277B = */
+    { { 0x10000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x277C = */
+    { { 0x00400010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x277D = */
+    { { 0x00000800, 0x00000101, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x28 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2823 = */
+    { { 0x00000800, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2824 = */
+    { { 0x00000000, 0x01000002, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2825 = */
+    { { 0x00000000, 0x04000000, 0x00800200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2826 = */
+    { { 0x00040040, 0x02000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2827 = */
+    { { 0x00400000, 0x80000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2828 = */
+    { { 0x00000000, 0x00000000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2829 = */
+    { { 0x00000000, 0x00020000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x282D = */
+    { { 0x00100000, 0x40000000, 0x02900000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x282E = */
+    { { 0x00000000, 0x10041000, 0x42000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x282F = */
+    { { 0x00000000, 0x00000088, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2833 = */
+    { { 0x00000000, 0x00000000, 0x08008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2834 = */
+    { { 0x00005000, 0x00800000, 0x00000044 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2835 = */
+    { { 0x00000400, 0x08000044, 0x00002002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2836 = */
+    { { 0x00000000, 0x00000000, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2839 = */
+    { { 0x00000000, 0x10200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x283B = */
+    { { 0x00000004, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x283D = */
+    { { 0x00010000, 0x00000000, 0x00004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x283F = */
+    { { 0x00010000, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2840 = */
+    { { 0x00000080, 0x40400000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2841 = */
+    { { 0x00000000, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2842 = */
+    { { 0x00000800, 0x00800000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2843 = */
+    { { 0x06A80000, 0x02010021, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2845 = */
+    { { 0x02000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2846 = */
+    { { 0x00000000, 0x00021004, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2849 = */
+    { { 0x00100000, 0x00000000, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x284B = */
+    { { 0x00000100, 0x00000008, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x284C = */
+    { { 0x00004000, 0x00000002, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x284D = */
+    { { 0x00000880, 0x03000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x284E = */
+    { { 0x40010000, 0x00000006, 0x00000044 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x284F = */
+    { { 0x02000040, 0x20000000, 0x20000802 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2850 = */
+    { { 0x00000200, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2851 = */
+    { { 0x00000000, 0x00010000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2852 = */
+    { { 0x00000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2853 = */
+    { { 0x10000008, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2854 = */
+    { { 0x00000010, 0x00008000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2857 = */
+    { { 0x00000000, 0xC0000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2858 = */
+    { { 0x00400800, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285A = */
+    { { 0x00000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285B = */
+    { { 0x00000002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285C = */
+    { { 0x04000000, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285D = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285E = */
+    { { 0x00000000, 0x00000000, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x285F = */
+    { { 0x00000000, 0x40000100, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2860 = */
+    { { 0x04840800, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2862 = */
+    { { 0x00000004, 0x00000000, 0x00040000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2863 = */
+    { { 0x00001000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2864 = */
+    { { 0x00000000, 0x04000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2865 = */
+    { { 0x00000000, 0x00000001, 0x00800400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2866 = */
+    { { 0x00000004, 0x00200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x286A = */
+    { { 0x10000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x286B = */
+    { { 0x00000000, 0x00000000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x286C = */
+    { { 0x00000000, 0x01000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x286D = */
+    { { 0x00000000, 0x00100080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x286E = */
+    { { 0x00000000, 0x00400000, 0x00000300 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2870 = */
+    { { 0x00214004, 0x00000424, 0x00000426 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2871 = */
+    { { 0x02110000, 0x00002010, 0x21100082 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2872 = */
+    { { 0x50420600, 0xE00A0180, 0x02260200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2873 = */
+    { { 0x00002002, 0x22064200, 0x00102001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2874 = */
+    { { 0x00024000, 0x00000000, 0x00040000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2875 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2876 = */
+    { { 0x00000000, 0x00200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2877 = */
+    { { 0x82000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2878 = */
+    { { 0x00000000, 0x00200000, 0x00004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2879 = */
+    { { 0x00000000, 0x00000002, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x287A = */
+    { { 0x00000000, 0x00400000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x287E = */
+    { { 0x00000000, 0x00000000, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x29 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2923 = */
+    { { 0x30000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2924 = */
+    { { 0x04080000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2925 = */
+    { { 0x00202010, 0x04000840, 0x00920090 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2926 = */
+    { { 0x00080000, 0x01820000, 0x00000102 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2927 = */
+    { { 0x00000000, 0x00040000, 0x00000120 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2928 = */
+    { { 0x00000400, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x292A = */
+    { { 0x00108000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x292B = */
+    { { 0x00000000, 0x00200000, 0x00004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x292C = */
+    { { 0x00000000, 0x20201000, 0x00000012 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x292D = */
+    { { 0x00000000, 0x00020000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x292F = */
+    { { 0x00000000, 0x00000000, 0x00040001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2930 = */
+    { { 0x00042000, 0x00000000, 0x20008040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2931 = */
+    { { 0x00040800, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2932 = */
+    { { 0x18000400, 0x60418000, 0x40020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2933 = */
+    { { 0x09401020, 0x22804031, 0x24080004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2934 = */
+    { { 0x01010000, 0x02002000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2935 = */
+    { { 0x02802000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2936 = */
+    { { 0x00000000, 0x80024000, 0x40010C00 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2937 = */
+    { { 0x04000060, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2938 = */
+    { { 0x00000000, 0x00000000, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x293A = */
+    { { 0x00004000, 0xC0800041, 0x00010801 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x293B = */
+    { { 0xC0000000, 0x0A008084, 0x04002800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x293C = */
+    { { 0x00010000, 0x04800000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x293D = */
+    { { 0x00000000, 0x00004000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x293F = */
+    { { 0x00000008, 0x14001000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2940 = */
+    { { 0x00021802, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2941 = */
+    { { 0x00000000, 0x30000000, 0x02000C1E } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2942 = */
+    { { 0x0082013E, 0x91360800, 0x0010A013 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2943 = */
+    { { 0x00228800, 0x0B218249, 0x20261414 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2944 = */
+    { { 0x40206880, 0x09802003, 0x01362240 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2945 = */
+    { { 0x00060000, 0x40026000, 0x04008190 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2946 = */
+    { { 0x00002302, 0x04400484, 0x10000044 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2947 = */
+    { { 0x50148000, 0x41032000, 0x00100281 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2948 = */
+    { { 0xC0000000, 0x10000400, 0x00028200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2949 = */
+    { { 0x00400000, 0x0405A314, 0x00008201 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x294A = */
+    { { 0x00000000, 0x00000050, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x294C = */
+    { { 0x00000000, 0x00000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x294E = */
+    { { 0x00000000, 0x10100008, 0x0A000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x294F = */
+    { { 0x00001008, 0x00000000, 0x00800800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2950 = */
+    { { 0x00030202, 0x00080000, 0x00001000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2951 = */
+    { { 0x00040000, 0x00080000, 0x00252440 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2952 = */
+    { { 0x00000004, 0x00000000, 0x00000208 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2953 = */
+    { { 0x20000000, 0x04000081, 0x06010601 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2954 = */
+    { { 0x00080086, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2955 = */
+    { { 0x00000000, 0x00000000, 0x00101000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2956 = */
+    { { 0x10000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2957 = */
+    { { 0x32020A02, 0x80400004, 0x14004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2958 = */
+    { { 0x4012B1A4, 0x12100800, 0x00024400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2959 = */
+    { { 0x0D040722, 0x01208001, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295A = */
+    { { 0x00000100, 0x02000110, 0x00210120 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295B = */
+    { { 0x00200400, 0x12040000, 0x02801801 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295C = */
+    { { 0x40000100, 0x08800280, 0x00001020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295D = */
+    { { 0x1C400200, 0x00000004, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295E = */
+    { { 0x00000000, 0x00000000, 0x14000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x295F = */
+    { { 0x00000800, 0x00000000, 0x18000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2960 = */
+    { { 0x00000900, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D30 = */
+    { { 0x00042002, 0x090A0020, 0x00001002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D31 = */
+    { { 0x04040000, 0x80001081, 0x00800030 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D32 = */
+    { { 0x00000010, 0x800A0000, 0x0204000A } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D33 = */
+    { { 0x00040410, 0x80408000, 0x00840840 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D34 = */
+    { { 0x30404102, 0x29880000, 0x00084410 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D35 = */
+    { { 0x12000000, 0x10400088, 0x00020400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D36 = */
+    { { 0x00040404, 0x00000014, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D37 = */
+    { { 0x00010000, 0x01000300, 0x10008120 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D38 = */
+    { { 0x80010002, 0x00140400, 0x00C04000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D39 = */
+    { { 0x00068202, 0x00502010, 0x08114000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3A = */
+    { { 0x00008040, 0x00000082, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3B = */
+    { { 0x80080480, 0x00140001, 0x0B804000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3C = */
+    { { 0x01400046, 0x80000200, 0x70016422 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3D = */
+    { { 0x0010AA00, 0x40014100, 0x00601080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3E = */
+    { { 0x10000800, 0x00000001, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D3F = */
+    { { 0x04020490, 0x00100000, 0x0040C080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D40 = */
+    { { 0x82020200, 0x00009200, 0x000000C0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D41 = */
+    { { 0x00040004, 0x001D0082, 0x00424000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D42 = */
+    { { 0x00000100, 0x00008200, 0x00840000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D43 = */
+    { { 0x48004280, 0x80000308, 0x00010014 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D44 = */
+    { { 0x04802020, 0x00010811, 0x20140842 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D45 = */
+    { { 0x06000000, 0x00014008, 0x00100214 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D46 = */
+    { { 0x00001002, 0x00000080, 0x10102000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D47 = */
+    { { 0x01210200, 0x88400040, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D48 = */
+    { { 0x00008200, 0x10090030, 0x00104800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D49 = */
+    { { 0x04000000, 0x00500080, 0x00020800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4A = */
+    { { 0x08100140, 0x09000060, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4B = */
+    { { 0x80200004, 0x08000028, 0x00060000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4C = */
+    { { 0x50203000, 0x20000000, 0x40000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4D = */
+    { { 0x01100002, 0x80008000, 0x00022020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4E = */
+    { { 0x00080010, 0x08000000, 0x02000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D4F = */
+    { { 0x40800200, 0x40000122, 0x10000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D50 = */
+    { { 0x00402800, 0x00008000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D51 = */
+    { { 0x00000210, 0x00002400, 0x22000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D52 = */
+    { { 0x010C0900, 0x22000403, 0x080018A0 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D53 = */
+    { { 0x0000100A, 0x40000811, 0x40000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D54 = */
+    { { 0x00100012, 0x000000C1, 0x00408102 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D55 = */
+    { { 0x00006200, 0x0C110080, 0x00080002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D56 = */
+    { { 0x90204000, 0x00000000, 0x08200010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D57 = */
+    { { 0x08012800, 0x09000200, 0x00080009 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D58 = */
+    { { 0x004A0000, 0x00402000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D59 = */
+    { { 0x20001080, 0x82809002, 0x00000029 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5A = */
+    { { 0x20100000, 0x80004100, 0x40000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5B = */
+    { { 0x00008000, 0x6000000C, 0x04000200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5C = */
+    { { 0x80008000, 0x0C000101, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5D = */
+    { { 0x00008008, 0x00400000, 0x00000120 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5E = */
+    { { 0x08000152, 0x00010408, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D5F = */
+    { { 0x08207100, 0x00001848, 0x00080008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D60 = */
+    { { 0x00012002, 0x00400000, 0x03000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D61 = */
+    { { 0x00140000, 0x06000080, 0x00000404 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D62 = */
+    { { 0x00201204, 0x80060002, 0x40200005 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D63 = */
+    { { 0x00002800, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D6B = */
+    { { 0x00080000, 0x80000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D6F = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D71 = */
+    { { 0x00000000, 0x00000008, 0x00000010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D73 = */
+    { { 0x00000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D75 = */
+    { { 0x04000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D7A = */
+    { { 0x00000000, 0x00000010, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2D7E = */
+    { { 0x00000000, 0x00000000, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E25 = */
+    { { 0x00000000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E28 = */
+    { { 0x00000000, 0x00001000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E29 = */
+    { { 0x00000000, 0x00000000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E2B = */
+    { { 0x00000000, 0x08000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E2D = */
+    { { 0x00000000, 0x00000000, 0x02000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E2F = */
+    { { 0x00000000, 0x00000000, 0x14000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E30 = */
+    { { 0x00000100, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E31 = */
+    { { 0x04000000, 0x00000010, 0x00040000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E33 = */
+    { { 0x00000100, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E36 = */
+    { { 0x80000000, 0x00100020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E37 = */
+    { { 0x00000200, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E38 = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E39 = */
+    { { 0x00400000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E3A = */
+    { { 0x00080040, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E3B = */
+    { { 0x00000004, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E3D = */
+    { { 0x00000000, 0x00000000, 0x00080004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E3E = */
+    { { 0x80000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E3F = */
+    { { 0x00002000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E40 = */
+    { { 0x20000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E41 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E46 = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E47 = */
+    { { 0x02020000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E48 = */
+    { { 0x00000000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E49 = */
+    { { 0x08008000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E4A = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E4C = */
+    { { 0x00200000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E4D = */
+    { { 0x20000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E4E = */
+    { { 0x00000000, 0x20400002, 0x00040000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E50 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E52 = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E54 = */
+    { { 0x00000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E5A = */
+    { { 0x00000000, 0x00000001, 0x01000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E5F = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E60 = */
+    { { 0x00000000, 0x00000400, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E62 = */
+    { { 0x00000000, 0x80008000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E68 = */
+    { { 0x00000000, 0x00004000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E6B = */
+    { { 0x00000000, 0x00100000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E6C = */
+    { { 0x400000C0, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E6F = */
+    { { 0x00200000, 0x00000008, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E70 = */
+    { { 0x00000000, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E71 = */
+    { { 0x00000000, 0x04000000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E73 = */
+    { { 0x00000100, 0x20000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E74 = */
+    { { 0x00024000, 0x00030000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E76 = */
+    { { 0x00000000, 0x80000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E7C = */
+    { { 0x00004000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2E7D = */
+    { { 0x00000010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F = */
+    { { 0x3D4AA420, 0xE7920415, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F25 = */
+    { { 0x00006000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F2A = */
+    { { 0x00000000, 0x04000000, 0x00080010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F2D = */
+    { { 0x00000000, 0x00000000, 0x02000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F2F = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F31 = */
+    { { 0x00000800, 0x00000008, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F33 = */
+    { { 0x00000000, 0x00000000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F36 = */
+    { { 0x02000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F38 = */
+    { { 0x00080000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F3A = */
+    { { 0x00000000, 0x40000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F3B = */
+    { { 0x00000000, 0x00000000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F3C = */
+    { { 0x00002000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F3D = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F40 = */
+    { { 0x00000000, 0x00080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F42 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F44 = */
+    { { 0x00000000, 0x80000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F4A = */
+    { { 0x00004000, 0x00000400, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F51 = */
+    { { 0x00000000, 0x01000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F54 = */
+    { { 0x00000000, 0x00000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F57 = */
+    { { 0x00000000, 0x80000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F58 = */
+    { { 0x00000000, 0x10000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F59 = */
+    { { 0x00000000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F5A = */
+    { { 0x00000000, 0x00000100, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F5D = */
+    { { 0x10000000, 0x10000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F5E = */
+    { { 0x00000000, 0x00000004, 0x20000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x2F5F = */
+    { { 0x00000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x33 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3330 = */
+    { { 0x04000002, 0x00021000, 0x01001041 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3331 = */
+    { { 0x00000000, 0x00001000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3332 = */
+    { { 0x00000000, 0x20020001, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3333 = */
+    { { 0x10010408, 0x00004010, 0x08800000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3334 = */
+    { { 0x0000010A, 0x00000000, 0x20200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3335 = */
+    { { 0x00000200, 0x10404000, 0x00080010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3336 = */
+    { { 0x00000408, 0x04000004, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3337 = */
+    { { 0x00000000, 0x00000000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3338 = */
+    { { 0x00000000, 0x00000000, 0x00004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3339 = */
+    { { 0x00008000, 0x00000010, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x333C = */
+    { { 0x00000002, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x333D = */
+    { { 0x00008500, 0x00101104, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x333E = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x333F = */
+    { { 0x80000014, 0x09200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3340 = */
+    { { 0x00000000, 0x00010020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3341 = */
+    { { 0x00020000, 0x00000000, 0x40000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3342 = */
+    { { 0x20000400, 0x00400018, 0x00800001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3343 = */
+    { { 0x40008000, 0x00800004, 0x00000200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3344 = */
+    { { 0x00000020, 0x00000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3345 = */
+    { { 0x00000080, 0x00010000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3346 = */
+    { { 0x10080002, 0x00000000, 0x04100020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3347 = */
+    { { 0x00010200, 0xC0200401, 0x08018000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3348 = */
+    { { 0x08000000, 0x40000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3349 = */
+    { { 0x00004000, 0x00000400, 0x00000500 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x334A = */
+    { { 0x00000100, 0x01000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x334C = */
+    { { 0x40C01000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x334E = */
+    { { 0x00800000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x334F = */
+    { { 0x04800000, 0x42000000, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3350 = */
+    { { 0x00000C00, 0x00000000, 0x00000020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3351 = */
+    { { 0x10004000, 0x10001080, 0x00042800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3352 = */
+    { { 0x81110108, 0x0A000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3353 = */
+    { { 0x00080000, 0x00000080, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3354 = */
+    { { 0x00000000, 0x00000060, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3355 = */
+    { { 0x00000000, 0x00000000, 0x00800102 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3356 = */
+    { { 0x00200000, 0x00040000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3357 = */
+    { { 0x01004000, 0x00000000, 0x000C0001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3358 = */
+    { { 0x00110002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3359 = */
+    { { 0x00000000, 0x01000002, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x335A = */
+    { { 0x00000000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x335B = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x335D = */
+    { { 0x08000008, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x335E = */
+    { { 0x20008002, 0x00000004, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x335F = */
+    { { 0x20100000, 0x00000208, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3360 = */
+    { { 0x00000000, 0x01100000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3361 = */
+    { { 0x00000000, 0x04000000, 0x02000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3362 = */
+    { { 0x00000000, 0xC0000000, 0x20200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3363 = */
+    { { 0x00000802, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x336B = */
+    { { 0x00080000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x336C = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3373 = */
+    { { 0x00000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x34 = */
+    { { 0x45000010, 0x60120202, 0x21120142 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3424 = */
+    { { 0x00000000, 0x00080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3438 = */
+    { { 0x00000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x343A = */
+    { { 0x00000000, 0x08000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x343E = */
+    { { 0x01000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3441 = */
+    { { 0x01000000, 0x00000000, 0x00800000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3449 = */
+    { { 0x00008000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3451 = */
+    { { 0x00000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3454 = */
+    { { 0x00000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x345D = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x345E = */
+    { { 0x08000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3461 = */
+    { { 0x00000040, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3466 = */
+    { { 0x00000004, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3468 = */
+    { { 0x00000400, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3471 = */
+    { { 0x00000000, 0x04000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3474 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3478 = */
+    { { 0x00000400, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x347D = */
+    { { 0x00000010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x35 = */
+    { { 0x00100000, 0x60810002, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3534 = */
+    { { 0x00000000, 0x00002000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3541 = */
+    { { 0x00000000, 0x00400000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3550 = */
+    { { 0x00000000, 0x00080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3557 = */
+    { { 0x02000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x355D = */
+    { { 0x00000000, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x355E = */
+    { { 0x00000000, 0x00000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x39 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3930 = */
+    { { 0x04002000, 0x00141000, 0x01000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3932 = */
+    { { 0x00000000, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3934 = */
+    { { 0x02000100, 0x08000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3935 = */
+    { { 0x00000000, 0x00000000, 0x00880000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3936 = */
+    { { 0x00000000, 0x44000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3937 = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3939 = */
+    { { 0x00000000, 0x00000010, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x393B = */
+    { { 0x02000000, 0x00000000, 0x01004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x393C = */
+    { { 0x00000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x393D = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x393E = */
+    { { 0x00000000, 0x00001080, 0x20000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3940 = */
+    { { 0x00000004, 0x00000004, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3941 = */
+    { { 0x00000000, 0x00000000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3942 = */
+    { { 0x00000000, 0x00008008, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3943 = */
+    { { 0x00010000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3944 = */
+    { { 0x00000000, 0x00000010, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3945 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3946 = */
+    { { 0x00100000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3947 = */
+    { { 0x00200000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3948 = */
+    { { 0x08000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3949 = */
+    { { 0x00000100, 0x00400010, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x394A = */
+    { { 0x00000000, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x394C = */
+    { { 0x00002000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3950 = */
+    { { 0x00000000, 0x08010000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3951 = */
+    { { 0x00000000, 0x00000000, 0x02000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3952 = */
+    { { 0x00010000, 0x08000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3954 = */
+    { { 0x00000000, 0x00000000, 0x00800000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3955 = */
+    { { 0x10000000, 0x00000000, 0x00800110 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3956 = */
+    { { 0x10000000, 0x00040008, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3957 = */
+    { { 0x00000000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3958 = */
+    { { 0x00000202, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3959 = */
+    { { 0x80000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x395A = */
+    { { 0x00408000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x395D = */
+    { { 0x00000008, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x395E = */
+    { { 0x20008000, 0x00000004, 0x00028000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x395F = */
+    { { 0x00000000, 0x00000200, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3960 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3961 = */
+    { { 0x00000000, 0x00000000, 0x02000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3962 = */
+    { { 0x00000008, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x396B = */
+    { { 0x00088000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x396C = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A = */
+    { { 0x08008100, 0x00000001, 0x03000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A28 = */
+    { { 0x00000000, 0x00001000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A2F = */
+    { { 0x00000000, 0x00000000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A3B = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A40 = */
+    { { 0x00100000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A6A = */
+    { { 0x00000000, 0x00000000, 0x10000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A78 = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3A79 = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3B = */
+    { { 0x02002000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3B2D = */
+    { { 0x00000000, 0x00000010, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3B39 = */
+    { { 0x00000004, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F = */
+    { { 0xE0B10000, 0xC26216F5, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F30 = */
+    { { 0x00000000, 0x00001000, 0x01000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F34 = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F35 = */
+    { { 0x00000000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F37 = */
+    { { 0x00000000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F3D = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F3E = */
+    { { 0x00000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F3F = */
+    { { 0x00000010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F40 = */
+    { { 0x00000000, 0x00008000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F42 = */
+    { { 0x00000000, 0x00008000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F44 = */
+    { { 0x00000000, 0x00000000, 0x00040000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F45 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F46 = */
+    { { 0x00000A02, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F47 = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F49 = */
+    { { 0x00000040, 0x00400000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F4A = */
+    { { 0x00000100, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F4C = */
+    { { 0x10000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F51 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F55 = */
+    { { 0x00000000, 0x00000000, 0x00000010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F56 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F59 = */
+    { { 0x00000000, 0x02000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F5E = */
+    { { 0x00000000, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F5F = */
+    { { 0x00300000, 0x00000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x3F61 = */
+    { { 0x00000000, 0x00001000, 0x02000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x45 = */
+    { { 0xA0D90000, 0xE1E2D8E2, 0x0000000D } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4530 = */
+    { { 0x00000000, 0x00021000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4533 = */
+    { { 0x00400000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4534 = */
+    { { 0x00000002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4536 = */
+    { { 0x00000000, 0x00000000, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4537 = */
+    { { 0x00000000, 0x00200000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x453D = */
+    { { 0x00000000, 0x00080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x453F = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4541 = */
+    { { 0x00000000, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4545 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4546 = */
+    { { 0x00000800, 0x08000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4547 = */
+    { { 0x01000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x454B = */
+    { { 0x00000000, 0x00000000, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x454C = */
+    { { 0x10000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x454E = */
+    { { 0x00000000, 0x00000008, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x454F = */
+    { { 0x00000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4551 = */
+    { { 0x00000004, 0x00000000, 0x00000010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4555 = */
+    { { 0x00000000, 0x00000000, 0x00000010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4556 = */
+    { { 0x00000000, 0x00000800, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4557 = */
+    { { 0x00000000, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4558 = */
+    { { 0x00800000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x455D = */
+    { { 0x40000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x455E = */
+    { { 0x00000002, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x455F = */
+    { { 0x00200000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4560 = */
+    { { 0x00400000, 0x00004000, 0x00400810 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4562 = */
+    { { 0x00000000, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4563 = */
+    { { 0x00000010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x46 = */
+    { { 0x00000100, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4628 = */
+    { { 0x00000000, 0x00001000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4660 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x47 = */
+    { { 0x00701000, 0x02844204, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x472C = */
+    { { 0x00000000, 0x00002000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4734 = */
+    { { 0x00000004, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4735 = */
+    { { 0x02000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4736 = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4742 = */
+    { { 0x00400000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4749 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x474E = */
+    { { 0x00000000, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4752 = */
+    { { 0x00000004, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4757 = */
+    { { 0x00000000, 0x00000000, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4759 = */
+    { { 0x00000000, 0x00004000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B30 = */
+    { { 0x00000002, 0x00870000, 0x00045000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B31 = */
+    { { 0x00012000, 0x00001010, 0x11000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B32 = */
+    { { 0x00020000, 0x80004100, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B33 = */
+    { { 0x40000016, 0x08320000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B34 = */
+    { { 0x00600002, 0x00000000, 0x00100800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B35 = */
+    { { 0x00000000, 0x00000000, 0x08000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B36 = */
+    { { 0x00000004, 0x00000004, 0x00000140 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B37 = */
+    { { 0x00009000, 0x05001200, 0x001C8100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B38 = */
+    { { 0x00004000, 0x40090000, 0x20031210 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B39 = */
+    { { 0xC5000000, 0x00000000, 0x08100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3A = */
+    { { 0x00008000, 0x00000280, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3B = */
+    { { 0x00820004, 0x00040008, 0x42000082 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3C = */
+    { { 0x010C880A, 0x40080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3D = */
+    { { 0x00009490, 0x10001800, 0x00000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3E = */
+    { { 0x00000400, 0x08000001, 0x40000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B3F = */
+    { { 0x00000000, 0x000B0C01, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B40 = */
+    { { 0x20000000, 0x00080240, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B41 = */
+    { { 0x00200400, 0x000000C0, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B42 = */
+    { { 0x04600000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B43 = */
+    { { 0x02000000, 0x01042080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B44 = */
+    { { 0x00002000, 0x00400010, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B45 = */
+    { { 0x00900000, 0x02480030, 0x0001B202 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B46 = */
+    { { 0x01004402, 0x04200000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B47 = */
+    { { 0x00000000, 0x02000002, 0x00001082 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B48 = */
+    { { 0x00200000, 0x81801C40, 0x00100040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B49 = */
+    { { 0x00824822, 0x00000081, 0x00A80C00 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4A = */
+    { { 0x41004000, 0x00000020, 0x01100004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4B = */
+    { { 0x40001800, 0x00000000, 0x00820008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4C = */
+    { { 0x10400000, 0x08020000, 0x02000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4D = */
+    { { 0x00000000, 0x02400022, 0x08080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4E = */
+    { { 0x02800002, 0x08400000, 0x08000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B4F = */
+    { { 0x10000200, 0x00001008, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B50 = */
+    { { 0x08400000, 0x00040010, 0x00001002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B51 = */
+    { { 0x08000000, 0x04100000, 0x42406410 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B52 = */
+    { { 0x4100088A, 0x1C004080, 0x10804000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B53 = */
+    { { 0x08000000, 0x00000000, 0x20000022 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B54 = */
+    { { 0x00900104, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B55 = */
+    { { 0x84001002, 0x00000004, 0x00000010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B56 = */
+    { { 0x84060A00, 0x00000080, 0x00020400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B57 = */
+    { { 0x00400010, 0x00000041, 0x40089000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B58 = */
+    { { 0x00050050, 0x00000000, 0x04020002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B59 = */
+    { { 0x00400000, 0x02000C40, 0x00080018 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5A = */
+    { { 0x08020008, 0x00000000, 0x40000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5B = */
+    { { 0x00000200, 0x41240040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5C = */
+    { { 0x02040000, 0x48110080, 0x00840000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5D = */
+    { { 0x01500800, 0x01000004, 0x00010020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5E = */
+    { { 0xA0000080, 0x20000000, 0x00001200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B5F = */
+    { { 0x04210000, 0x01011200, 0x000F8004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B60 = */
+    { { 0x00002000, 0x00080110, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B61 = */
+    { { 0x80010004, 0x820020A0, 0x00000180 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B62 = */
+    { { 0x08000000, 0x11008080, 0x01000141 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B63 = */
+    { { 0x00000010, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B64 = */
+    { { 0x00000000, 0x00200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B66 = */
+    { { 0x00800000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B68 = */
+    { { 0x00004000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B6A = */
+    { { 0x00000044, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B74 = */
+    { { 0x00000002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B75 = */
+    { { 0x00000000, 0x00000000, 0x00800000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B76 = */
+    { { 0x20000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B78 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B79 = */
+    { { 0x00000000, 0x00100000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4B7E = */
+    { { 0x00000000, 0x00000000, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C23 = */
+    { { 0x80010000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C25 = */
+    { { 0x02040000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C28 = */
+    { { 0x00000000, 0x00001000, 0x00000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C29 = */
+    { { 0x00000000, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C2F = */
+    { { 0x00000000, 0x00000000, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C34 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C35 = */
+    { { 0x00000000, 0x00000400, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C37 = */
+    { { 0x00000000, 0x00000010, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C3A = */
+    { { 0x00080000, 0x08200000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C3B = */
+    { { 0x00020004, 0x00000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C3F = */
+    { { 0x00000000, 0x00000000, 0x04000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C41 = */
+    { { 0x00000000, 0x00000040, 0x00800000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C43 = */
+    { { 0x82080000, 0x02000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C44 = */
+    { { 0x00000000, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C47 = */
+    { { 0x00000000, 0x00000000, 0x00004000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C4C = */
+    { { 0x00200000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C4D = */
+    { { 0x20000000, 0x00000000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C4F = */
+    { { 0x00000850, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C51 = */
+    { { 0x00000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C52 = */
+    { { 0x04000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C54 = */
+    { { 0x00000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C55 = */
+    { { 0x00000000, 0x00000002, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C56 = */
+    { { 0x01000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C5C = */
+    { { 0x04000000, 0x00000000, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C5F = */
+    { { 0x00000000, 0x01000000, 0x00000200 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C60 = */
+    { { 0x00000004, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C62 = */
+    { { 0x00000000, 0x00000000, 0x00000040 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C63 = */
+    { { 0x00000000, 0x00000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C65 = */
+    { { 0x00000000, 0x00000000, 0x00000030 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C67 = */
+    { { 0x00000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C68 = */
+    { { 0x40000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C69 = */
+    { { 0x00000000, 0x90000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C6B = */
+    { { 0x00000000, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C6C = */
+    { { 0x00000000, 0x00000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C6E = */
+    { { 0x00000000, 0x00000004, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C6F = */
+    { { 0x00000000, 0x00000008, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C71 = */
+    { { 0x00000000, 0x04000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C72 = */
+    { { 0x00000000, 0x20000000, 0x00000020 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C73 = */
+    { { 0x00000100, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C79 = */
+    { { 0x00000000, 0x02004000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C7C = */
+    { { 0x00000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4C7D = */
+    { { 0x00000000, 0x00002000, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D = */
+    { { 0x1109B204, 0xBF23A592, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D22 = */
+    { { 0x00000400, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D29 = */
+    { { 0x00000020, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D2C = */
+    { { 0x10000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D2D = */
+    { { 0x00000000, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D2F = */
+    { { 0x00000000, 0x20000000, 0x04080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D30 = */
+    { { 0x00040000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D33 = */
+    { { 0x00000000, 0x02000000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D38 = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D3C = */
+    { { 0x00000000, 0x00000000, 0x00001000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D41 = */
+    { { 0x00100000, 0x00000000, 0x00400000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D44 = */
+    { { 0x00000000, 0x08000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D47 = */
+    { { 0x00001000, 0x00100000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D48 = */
+    { { 0x00240000, 0x00000000, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D4A = */
+    { { 0x00000000, 0x00000000, 0x00001000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D4D = */
+    { { 0x00000000, 0x00000000, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D4F = */
+    { { 0x02000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D50 = */
+    { { 0x04000000, 0x00080000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D51 = */
+    { { 0x00000000, 0x00100000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D55 = */
+    { { 0x00000000, 0x00000000, 0x00100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D58 = */
+    { { 0x00000000, 0x01000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D59 = */
+    { { 0x00100000, 0x00004000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D5A = */
+    { { 0x00000000, 0x00000000, 0x00001000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D5B = */
+    { { 0x00200000, 0x00000000, 0x40000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D5C = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D5D = */
+    { { 0x00000000, 0x00000200, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D5F = */
+    { { 0x00000000, 0x00000000, 0x08010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x4D60 = */
+    { { 0x00000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x51 = */
+    { { 0x2D310000, 0x40424220, 0x02000402 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5130 = */
+    { { 0x00000000, 0x00820000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5134 = */
+    { { 0x00000002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5135 = */
+    { { 0x00000000, 0x00000000, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5138 = */
+    { { 0x00000000, 0x00002000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x513A = */
+    { { 0x00000000, 0x00000080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x513B = */
+    { { 0x00000000, 0x00040000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x513D = */
+    { { 0x00000000, 0x00000000, 0x00000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5145 = */
+    { { 0x00000000, 0x00000000, 0x00002000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5149 = */
+    { { 0x00000000, 0x00000000, 0x00000800 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x514E = */
+    { { 0x00000000, 0x08000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5151 = */
+    { { 0x08000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5156 = */
+    { { 0x80000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x515E = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5161 = */
+    { { 0x00000004, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x516A = */
+    { { 0x00000040, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5179 = */
+    { { 0x00000000, 0x00100000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x52 = */
+    { { 0x00000000, 0x00000000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x5273 = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x69 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6921 = */
+    { { 0x12000040, 0x003C0000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6924 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6925 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6937 = */
+    { { 0x00000200, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x693C = */
+    { { 0x00440000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6946 = */
+    { { 0x00000000, 0x00000000, 0x00800010 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6948 = */
+    { { 0x01000808, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x694B = */
+    { { 0x00000000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x694C = */
+    { { 0x00000000, 0x20000000, 0x04000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6951 = */
+    { { 0x00010000, 0x40000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6952 = */
+    { { 0x00000000, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6953 = */
+    { { 0x08000040, 0x00000000, 0x00200000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6954 = */
+    { { 0x0D000600, 0x90820804, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6955 = */
+    { { 0x00000000, 0x00004000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6956 = */
+    { { 0x000D5040, 0x00804000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6957 = */
+    { { 0x08800000, 0x00000000, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6959 = */
+    { { 0x00000000, 0x40000800, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695A = */
+    { { 0x00020000, 0x00000000, 0x40080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695B = */
+    { { 0x00800000, 0x00000000, 0x08000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695C = */
+    { { 0x02032200, 0x00088008, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695D = */
+    { { 0x00400000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695E = */
+    { { 0x00000000, 0x00000000, 0x00000008 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x695F = */
+    { { 0x00000000, 0x00000000, 0x00010000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6961 = */
+    { { 0x44400040, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6962 = */
+    { { 0x00000000, 0x00000000, 0x00082000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6963 = */
+    { { 0x00000020, 0x00004000, 0x00080000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6964 = */
+    { { 0x00000000, 0x00005200, 0x00120050 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6965 = */
+    { { 0x00000000, 0x00008000, 0x00406000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6967 = */
+    { { 0x00080000, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6968 = */
+    { { 0x00000000, 0x00002000, 0x00000100 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6969 = */
+    { { 0x00000000, 0x08000040, 0x00000004 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x696A = */
+    { { 0x00001000, 0x40000000, 0x00002002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x696B = */
+    { { 0x00000080, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x696D = */
+    { { 0x80000000, 0x04000003, 0x04000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x696E = */
+    { { 0x00000100, 0x10000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x696F = */
+    { { 0x00000080, 0x28000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6970 = */
+    { { 0x00000008, 0x21000000, 0x00000001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6971 = */
+    { { 0x00000010, 0x00040000, 0x60100000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6972 = */
+    { { 0x08000000, 0x00004061, 0x40000021 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6973 = */
+    { { 0x00000008, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F = */
+    { { 0x00000030, 0x7FFFFF00, 0x00C00000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F24 = */
+    { { 0x00000000, 0xFF800000, 0x4DDF423F } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F25 = */
+    { { 0x000001E2, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F48 = */
+    { { 0x00000000, 0x80000000, 0x7FEFFFFF } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F49 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4E = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F4F = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F50 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F51 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F52 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F53 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F54 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F55 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F56 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F57 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F58 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F59 = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F5A = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F5B = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F5C = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F5D = */
+    { { 0x00000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F5E = */
+    { { 0x00000002, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F76 = */
+    { { 0x0000003E, 0x00FFFFFF, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x6F77 = */
+    { { 0x7FFFFFFE, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x70 = */
+    { { 0x00000000, 0xB9001000, 0x00BC384F } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x704C = */
+    { { 0x00000400, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7058 = */
+    { { 0x00000000, 0x00000000, 0x00008000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x705B = */
+    { { 0x00000000, 0x00000000, 0x00020000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x705C = */
+    { { 0x00000000, 0x00010008, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x705D = */
+    { { 0x00000000, 0x10000040, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x705F = */
+    { { 0x02010000, 0x08130000, 0x00000002 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7060 = */
+    { { 0x04002000, 0x01101000, 0x00000080 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7061 = */
+    { { 0x00020000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7062 = */
+    { { 0x00000400, 0x00004080, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7063 = */
+    { { 0x00000000, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7066 = */
+    { { 0x00000000, 0x00000001, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x706B = */
+    { { 0x00000000, 0x88001014, 0x00000400 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x706C = */
+    { { 0x00000000, 0x0000000C, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x706D = */
+    { { 0x88000000, 0x00000020, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7072 = */
+    { { 0x00000000, 0x00000000, 0x20000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7073 = */
+    { { 0x00000000, 0x00000000, 0x00004001 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7074 = */
+    { { 0x01000000, 0x00000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7075 = */
+    { { 0x00000008, 0x20000000, 0x00000000 } },
+/* bib_iconv_marc8_eacc_charset multibyte prefix 0x7077 = */
+    { { 0x00000000, 0x20000000, 0x00020000 } },
 }};
@@ -0,0 +1,88 @@
+//
+//  nfc_tables.h
+//  bibiconv
+//
+
+#ifndef BIBICONV_NFC_TABLES_H
+#define BIBICONV_NFC_TABLES_H
+
+#include <bibiconv/cfeatures.h>
+#include <bibiconv/chartypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Canonical Combining Classes
+
+/**
+ * Look up the canonical combining class of a character, which orders the
+ * combining characters that modify the same character in normalized text.
+ *
+ * - parameter c: The character to look up.
+ * - returns: The canonical combining class of `c`, or `0` when `c` isn't a
+ *   combining character that a MARC-8 character set can decode into.
+ *
+ * Combining characters are in canonical order when each one's class is
+ * greater than or equal to the class of the one before it.
+ */
+unsigned char bib_iconv_combining_class(ucs4_t c);
+
+#pragma mark - Canonical Composition
+
+/**
+ * Look up the precomposed character for a character followed by a combining
+ * character, as Unicode Normalization Form C (NFC) composes them.
+ *
+ * - parameter starter: The character that the combining character modifies.
+ *   This may itself be a precomposed character.
+ * - parameter mark: The combining character.
+ * - returns: The primary composite of `starter` and `mark`, or `0` when they
+ *   don't compose.
+ *
+ * Only the combining characters that a MARC-8 character set can decode into,
+ * and the horn that ``bib_iconv_nfc_decompose`` decomposes characters into,
+ * are in the composition tables, so this returns `0` for any other `mark`.
+ */
+ucs4_t bib_iconv_nfc_compose(ucs4_t starter, ucs4_t mark);
+
+#pragma mark - Canonical Decompositions
+
+/**
+ * Look up the canonical decomposition of a precomposed character that has to
+ * be decomposed before it's composed with the combining characters that
+ * modify it.
+ *
+ * - parameter c: The character to look up.
+ * - parameter mark: The location to store the combining character that `c`
+ *   decomposes into, or `0` when `c` isn't decomposed.
+ * - returns: The character that `mark` modifies, or `c` when it isn't
+ *   decomposed.
+ *
+ * Only ANSEL's letters with a horn are in the table of decompositions. The
+ * horn's canonical combining class is greater than a cedilla's or an
+ * ogonek's, so those are composed with the letter before the horn is. Every
+ * other precomposed character in MARC-8 composes the same way whether or not
+ * it's decomposed first.
+ */
+ucs4_t bib_iconv_nfc_decompose(ucs4_t c, ucs4_t *restrict mark);
+
+/**
+ * Look up the character that a character is replaced with in Unicode
+ * Normalization Form C (NFC), when its canonical decomposition is a single
+ * different character.
+ *
+ * - parameter c: The character to look up.
+ * - returns: The character that replaces `c` in normalized text, or `c` when
+ *   it's already normalized.
+ *
+ * Only the characters that a MARC-8 character set can decode into are in the
+ * table of singleton decompositions, which are a few Greek punctuation marks.
+ */
+ucs4_t bib_iconv_nfc_singleton(ucs4_t c);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* BIBICONV_NFC_TABLES_H */
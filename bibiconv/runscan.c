@@ -0,0 +1,347 @@
+//
+//  runscan.c
+//  bibiconv
+//
+
+#include "runscan.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* SSE2 is only available on x86 processors, which are all little endian, so
+ * widening bytes by interleaving them with zeros produces native UTF-16 and
+ * UTF-32 code units. */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#pragma mark - ASCII Runs
+
+#if !defined(__SSE2__)
+/** A machine word with each of its bytes set to `byte`. */
+#define REPEAT_BYTE(byte) ((UINTMAX_MAX / 0xFF) * (byte))
+
+/**
+ * Test whether a machine word contains a byte outside of the range
+ * `0x1D`-`0x7F`.
+ *
+ * Bytes less than `0x1D` borrow into their high bit when subtracting `0x1D`
+ * from each byte. Bytes that already have their high bit set are caught by
+ * or-ing the original word in.
+ */
+static inline bool has_non_marc8_ascii(uintmax_t word) {
+    uintmax_t const below = (word - REPEAT_BYTE(0x1D)) | word;
+    return (below & REPEAT_BYTE(0x80)) != 0;
+}
+#endif
+
+size_t bib_iconv_scan_marc8_ascii(char const *src, size_t length) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const low = _mm256_set1_epi8(0x1C);
+    while (length - n >= 32) {
+        /* Bytes with their high bit set are negative, and fail the comparison
+         * along with the control characters below `0x1D`. */
+        __m256i const bytes = _mm256_loadu_si256((__m256i const *)(src + n));
+        uint32_t const mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpgt_epi8(bytes, low));
+        if (mask != UINT32_MAX) {
+            return n + (size_t)__builtin_ctz(~mask);
+        }
+        n += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const low128 = _mm_set1_epi8(0x1C);
+    while (length - n >= 16) {
+        __m128i const bytes = _mm_loadu_si128((__m128i const *)(src + n));
+        unsigned const mask = (unsigned)_mm_movemask_epi8(
+            _mm_cmpgt_epi8(bytes, low128));
+        if (mask != 0xFFFF) {
+            return n + (size_t)__builtin_ctz(~mask);
+        }
+        n += 16;
+    }
+#else
+    while (length - n >= sizeof(uintmax_t)) {
+        uintmax_t word;
+        memcpy(&word, src + n, sizeof(word));
+        if (has_non_marc8_ascii(word)) {
+            break;
+        }
+        n += sizeof(uintmax_t);
+    }
+#endif
+    while (n < length) {
+        unsigned char const c = src[n];
+        if (c < 0x1D || c > 0x7F) {
+            break;
+        }
+        n += 1;
+    }
+    return n;
+}
+
+void bib_iconv_widen_utf16(char *restrict dst, char const *restrict src,
+                           size_t length) {
+    size_t n = 0;
+#if defined(__SSE2__)
+    __m128i const zero = _mm_setzero_si128();
+    for (; length - n >= 16; n += 16) {
+        __m128i const bytes = _mm_loadu_si128((__m128i const *)(src + n));
+        __m128i *out = (__m128i *)(dst + n * sizeof(char16_t));
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(bytes, zero));
+    }
+#endif
+    for (; n < length; n += 1) {
+        ((char16_t *)dst)[n] = (char16_t)(unsigned char)src[n];
+    }
+}
+
+void bib_iconv_widen_utf32(char *restrict dst, char const *restrict src,
+                           size_t length) {
+    size_t n = 0;
+#if defined(__SSE2__)
+    __m128i const zero = _mm_setzero_si128();
+    for (; length - n >= 16; n += 16) {
+        __m128i const bytes = _mm_loadu_si128((__m128i const *)(src + n));
+        __m128i const low = _mm_unpacklo_epi8(bytes, zero);
+        __m128i const high = _mm_unpackhi_epi8(bytes, zero);
+        __m128i *out = (__m128i *)(dst + n * sizeof(char32_t));
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+#endif
+    for (; n < length; n += 1) {
+        ((char32_t *)dst)[n] = (char32_t)(unsigned char)src[n];
+    }
+}
+
+#pragma mark - Single-Byte Runs
+
+#if defined(__AVX2__)
+/**
+ * Look up 8 bytes from `src` in `table` with a vector gather.
+ */
+static inline __m256i gather_code_points(char const *src,
+                                         ucs4_t const table[256]) {
+    __m128i const bytes = _mm_loadl_epi64((__m128i const *)src);
+    __m256i const indices = _mm256_cvtepu8_epi32(bytes);
+    return _mm256_i32gather_epi32((int const *)table, indices, 4);
+}
+#endif
+
+size_t bib_iconv_map_utf16(char *restrict dst, char const *restrict src,
+                           size_t length, ucs4_t const table[256]) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const bmp_max = _mm256_set1_epi32(0xFFFF);
+    for (; length - n >= 8; n += 8) {
+        __m256i const code_points = gather_code_points(src + n, table);
+        __m256i const stops = _mm256_or_si256(
+            _mm256_cmpeq_epi32(code_points, zero),
+            _mm256_cmpgt_epi32(code_points, bmp_max));
+        if (!_mm256_testz_si256(stops, stops)) {
+            break;
+        }
+        /* Packing works within each 128-bit lane, so the two halves of the
+         * packed code units need to be moved next to each other. */
+        __m256i const packed = _mm256_permute4x64_epi64(
+            _mm256_packus_epi32(code_points, code_points), 0x08);
+        _mm_storeu_si128((__m128i *)(dst + n * sizeof(char16_t)),
+                         _mm256_castsi256_si128(packed));
+    }
+#endif
+    for (; n < length; n += 1) {
+        ucs4_t const c = table[(unsigned char)src[n]];
+        if (c == 0 || c > 0xFFFF) {
+            break;
+        }
+        ((char16_t *)dst)[n] = (char16_t)c;
+    }
+    return n;
+}
+
+size_t bib_iconv_map_utf32(char *restrict dst, char const *restrict src,
+                           size_t length, ucs4_t const table[256]) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const zero = _mm256_setzero_si256();
+    for (; length - n >= 8; n += 8) {
+        __m256i const code_points = gather_code_points(src + n, table);
+        __m256i const stops = _mm256_cmpeq_epi32(code_points, zero);
+        if (!_mm256_testz_si256(stops, stops)) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i *)(dst + n * sizeof(char32_t)),
+                            code_points);
+    }
+#endif
+    for (; n < length; n += 1) {
+        ucs4_t const c = table[(unsigned char)src[n]];
+        if (c == 0) {
+            break;
+        }
+        ((char32_t *)dst)[n] = (char32_t)c;
+    }
+    return n;
+}
+
+#pragma mark - Unicode Runs
+
+size_t bib_iconv_scan_utf8_ascii(char const *src, size_t length) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const zero = _mm256_setzero_si256();
+    while (length - n >= 32) {
+        /* Bytes with their high bit set show up in the byte mask directly. */
+        __m256i const bytes = _mm256_loadu_si256((__m256i const *)(src + n));
+        uint32_t const mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)));
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask);
+        }
+        n += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const zero128 = _mm_setzero_si128();
+    while (length - n >= 16) {
+        __m128i const bytes = _mm_loadu_si128((__m128i const *)(src + n));
+        unsigned const mask = (unsigned)_mm_movemask_epi8(
+            _mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero128)));
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask);
+        }
+        n += 16;
+    }
+#else
+    while (length - n >= sizeof(uintmax_t)) {
+        uintmax_t word;
+        memcpy(&word, src + n, sizeof(word));
+        /* Null bytes borrow into their high bit when subtracting `0x01` from
+         * each byte. */
+        uintmax_t const zeros = (word - REPEAT_BYTE(0x01)) & ~word;
+        if (((zeros | word) & REPEAT_BYTE(0x80)) != 0) {
+            break;
+        }
+        n += sizeof(uintmax_t);
+    }
+#endif
+    while (n < length) {
+        unsigned char const c = src[n];
+        if (c == 0 || c > 0x7F) {
+            break;
+        }
+        n += 1;
+    }
+    return n;
+}
+
+size_t bib_iconv_scan_utf16_bmp(char const *src, size_t length) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const surrogate_bits = _mm256_set1_epi16((short)0xF800);
+    __m256i const surrogates = _mm256_set1_epi16((short)0xD800);
+    while (length - n >= 16) {
+        __m256i const units = _mm256_loadu_si256(
+            (__m256i const *)(src + n * sizeof(char16_t)));
+        __m256i const stops = _mm256_or_si256(
+            _mm256_cmpeq_epi16(units, zero),
+            _mm256_cmpeq_epi16(_mm256_and_si256(units, surrogate_bits),
+                               surrogates));
+        uint32_t const mask = (uint32_t)_mm256_movemask_epi8(stops);
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask) / sizeof(char16_t);
+        }
+        n += 16;
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const zero128 = _mm_setzero_si128();
+    __m128i const surrogate_bits128 = _mm_set1_epi16((short)0xF800);
+    __m128i const surrogates128 = _mm_set1_epi16((short)0xD800);
+    while (length - n >= 8) {
+        __m128i const units = _mm_loadu_si128(
+            (__m128i const *)(src + n * sizeof(char16_t)));
+        __m128i const stops = _mm_or_si128(
+            _mm_cmpeq_epi16(units, zero128),
+            _mm_cmpeq_epi16(_mm_and_si128(units, surrogate_bits128),
+                            surrogates128));
+        unsigned const mask = (unsigned)_mm_movemask_epi8(stops);
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask) / sizeof(char16_t);
+        }
+        n += 8;
+    }
+#endif
+    while (n < length) {
+        char16_t unit;
+        memcpy(&unit, src + n * sizeof(char16_t), sizeof(unit));
+        if (unit == 0 || (unit & 0xF800) == 0xD800) {
+            break;
+        }
+        n += 1;
+    }
+    return n;
+}
+
+size_t bib_iconv_scan_utf32_scalar(char const *src, size_t length) {
+    size_t n = 0;
+#if defined(__AVX2__)
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const plane_max = _mm256_set1_epi32(0x10);
+    __m256i const surrogates = _mm256_set1_epi32(0xD800 >> 11);
+    while (length - n >= 8) {
+        /* Shifting right keeps the signed comparison of planes from seeing
+         * code units at or above `0x80000000` as negative. */
+        __m256i const units = _mm256_loadu_si256(
+            (__m256i const *)(src + n * sizeof(char32_t)));
+        __m256i const stops = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi32(units, zero),
+                            _mm256_cmpgt_epi32(_mm256_srli_epi32(units, 16),
+                                               plane_max)),
+            _mm256_cmpeq_epi32(_mm256_srli_epi32(units, 11), surrogates));
+        uint32_t const mask = (uint32_t)_mm256_movemask_epi8(stops);
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask) / sizeof(char32_t);
+        }
+        n += 8;
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const zero128 = _mm_setzero_si128();
+    __m128i const plane_max128 = _mm_set1_epi32(0x10);
+    __m128i const surrogates128 = _mm_set1_epi32(0xD800 >> 11);
+    while (length - n >= 4) {
+        __m128i const units = _mm_loadu_si128(
+            (__m128i const *)(src + n * sizeof(char32_t)));
+        __m128i const stops = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(units, zero128),
+                         _mm_cmpgt_epi32(_mm_srli_epi32(units, 16),
+                                         plane_max128)),
+            _mm_cmpeq_epi32(_mm_srli_epi32(units, 11), surrogates128));
+        unsigned const mask = (unsigned)_mm_movemask_epi8(stops);
+        if (mask != 0) {
+            return n + (size_t)__builtin_ctz(mask) / sizeof(char32_t);
+        }
+        n += 4;
+    }
+#endif
+    while (n < length) {
+        char32_t unit;
+        memcpy(&unit, src + n * sizeof(char32_t), sizeof(unit));
+        if (unit == 0 || unit > 0x10FFFF || (unit >> 11) == (0xD800 >> 11)) {
+            break;
+        }
+        n += 1;
+    }
+    return n;
+}
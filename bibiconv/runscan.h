@@ -0,0 +1,144 @@
+//
+//  runscan.h
+//  bibiconv
+//
+
+#ifndef BIB_ICONV_RUNSCAN_H
+#define BIB_ICONV_RUNSCAN_H
+
+#include <stddef.h>
+#include <bibiconv/cfeatures.h>
+#include <bibiconv/chartypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - ASCII Runs
+
+/**
+ * Find the longest run of ASCII characters at the start of a string that stand
+ * for themselves in MARC-8 while Basic Latin is the G0 graphic set.
+ *
+ * - parameter src: The string of bytes to scan.
+ * - parameter length: The amount of bytes in `src` to scan.
+ * - returns: The amount of bytes at the start of `src` in the range from
+ *   `0x1D` (the MARC record terminator) to `0x7F` (ASCII `DEL`).
+ *
+ * Along with the printable ASCII characters, the run includes MARC's record
+ * terminator, field terminator, and subfield delimiter. It ends at the escape
+ * character (`0x1B`, `'\e'`), at the null character and the other control
+ * characters, or at any byte with its high bit set. When compiled with AVX2
+ * or SSE2 enabled, the bytes are checked 32 or 16 at a time. Otherwise they're
+ * checked 8 at a time within a machine word.
+ */
+size_t bib_iconv_scan_marc8_ascii(char const *src, size_t length);
+
+/**
+ * Widen a string of ASCII characters into UTF-16 code units.
+ *
+ * - parameter dst: The destination buffer with room for `length` UTF-16 code
+ *   units.
+ * - parameter src: The ASCII characters to widen.
+ * - parameter length: The amount of characters in `src`.
+ */
+void bib_iconv_widen_utf16(char *restrict dst, char const *restrict src,
+                           size_t length);
+
+/**
+ * Widen a string of ASCII characters into UTF-32 code units.
+ *
+ * - parameter dst: The destination buffer with room for `length` UTF-32 code
+ *   units.
+ * - parameter src: The ASCII characters to widen.
+ * - parameter length: The amount of characters in `src`.
+ */
+void bib_iconv_widen_utf32(char *restrict dst, char const *restrict src,
+                           size_t length);
+
+#pragma mark - Single-Byte Runs
+
+/**
+ * Map a run of single-byte characters into UTF-16 code units through a table.
+ *
+ * - parameter dst: The destination buffer with room for `length` UTF-16 code
+ *   units.
+ * - parameter src: The single-byte characters to map.
+ * - parameter length: The maximum amount of characters to map from `src`.
+ * - parameter table: A table from each byte to its Unicode code point, with
+ *   `0` for bytes that can't be mapped on their own.
+ * - returns: The amount of characters mapped from `src` and written to `dst`.
+ *
+ * The run ends at the first byte mapped to `0`, or to a code point outside of
+ * the Basic Multilingual Plane. When compiled with AVX2 enabled, the bytes are
+ * mapped 8 at a time with vector gathers.
+ */
+size_t bib_iconv_map_utf16(char *restrict dst, char const *restrict src,
+                           size_t length, ucs4_t const table[256]);
+
+/**
+ * Map a run of single-byte characters into UTF-32 code units through a table.
+ *
+ * - parameter dst: The destination buffer with room for `length` UTF-32 code
+ *   units.
+ * - parameter src: The single-byte characters to map.
+ * - parameter length: The maximum amount of characters to map from `src`.
+ * - parameter table: A table from each byte to its Unicode code point, with
+ *   `0` for bytes that can't be mapped on their own.
+ * - returns: The amount of characters mapped from `src` and written to `dst`.
+ *
+ * The run ends at the first byte mapped to `0`. When compiled with AVX2
+ * enabled, the bytes are mapped 8 at a time with vector gathers.
+ */
+size_t bib_iconv_map_utf32(char *restrict dst, char const *restrict src,
+                           size_t length, ucs4_t const table[256]);
+
+#pragma mark - Unicode Runs
+
+/**
+ * Find the longest run of non-null ASCII characters at the start of a string.
+ *
+ * - parameter src: The string of bytes to scan.
+ * - parameter length: The amount of bytes in `src` to scan.
+ * - returns: The amount of bytes at the start of `src` in the range from
+ *   `0x01` to `0x7F`.
+ *
+ * Each of these bytes is a whole UTF-8 character on its own. When compiled
+ * with AVX2 or SSE2 enabled, the bytes are checked 32 or 16 at a time.
+ * Otherwise they're checked 8 at a time within a machine word.
+ */
+size_t bib_iconv_scan_utf8_ascii(char const *src, size_t length);
+
+/**
+ * Find the longest run of UTF-16 code units at the start of a string that are
+ * each a whole, non-null character.
+ *
+ * - parameter src: The UTF-16 code units to scan, in native byte order.
+ * - parameter length: The amount of code units in `src` to scan.
+ * - returns: The amount of code units at the start of `src` that are neither
+ *   `0` nor surrogates.
+ *
+ * When compiled with AVX2 or SSE2 enabled, the code units are checked 16 or 8
+ * at a time.
+ */
+size_t bib_iconv_scan_utf16_bmp(char const *src, size_t length);
+
+/**
+ * Find the longest run of valid, non-null UTF-32 code units at the start of a
+ * string.
+ *
+ * - parameter src: The UTF-32 code units to scan, in native byte order.
+ * - parameter length: The amount of code units in `src` to scan.
+ * - returns: The amount of code units at the start of `src` that are Unicode
+ *   scalar values other than `0`.
+ *
+ * When compiled with AVX2 or SSE2 enabled, the code units are checked 8 or 4
+ * at a time.
+ */
+size_t bib_iconv_scan_utf32_scalar(char const *src, size_t length);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* BIB_ICONV_RUNSCAN_H */
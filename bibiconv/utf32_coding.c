@@ -6,7 +6,9 @@
 #include "cfeatures.h"
 #include "chartypes.h"
 #include "iconv_coding.h"
+#include "runscan.h"
 #include <string.h>
+#include <stdint.h>
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
@@ -32,7 +34,7 @@ static size_t utf32_read(bib_iconv_t cd, bib_iconv_decoder_t d,
         return (size_t)-1;
     }
 
-    char32_t code_point = *(char32_t const *)src;
+    char32_t code_point = *(char32_t const *)*src;
     if (code_point > 0x10FFFF
         || (code_point >= 0xD800 && code_point <= 0xDFFF)) {
         errno = EILSEQ;
@@ -75,18 +77,177 @@ static size_t utf32_write(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
     return 0;
 }
 
+static size_t utf32_read_block(bib_iconv_t cd, bib_iconv_decoder_t d,
+                               char const **restrict src,
+                               size_t *restrict srcleft,
+                               ucs4_t *restrict block, size_t *restrict count) {
+    assert(count != nullptr);
+    size_t const capacity = *count;
+    size_t n = 0;
+    while (n < capacity) {
+        if (utf32_read(cd, d, src, srcleft, &block[n]) == (size_t)-1) {
+            *count = n;
+            return (size_t)-1;
+        }
+        n += 1;
+        if (block[n - 1] == 0) {
+            break;
+        }
+    }
+    *count = n;
+    return 0;
+}
+
+static size_t utf32_write_block(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
+                                ucs4_t const *restrict block,
+                                size_t *restrict count,
+                                char **restrict dst, size_t *restrict len) {
+    (void)cd;
+    (void)e;
+    assert(count != nullptr);
+    assert(dst != nullptr);
+    assert(*dst != nullptr);
+    assert(len != nullptr);
+    size_t const total = *count;
+    if (*len / BIB_ICONV_MAX_WRITE_SIZE < total) {
+        *count = 0;
+        errno = E2BIG;
+        return (size_t)-1;
+    }
+    /* The whole block fits, so each code point is written without checking
+     * the remaining space in the destination buffer. */
+    char32_t *out = (char32_t *)*dst;
+    size_t n = 0;
+    for (; n < total; n += 1) {
+        ucs4_t c = block[n];
+        if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            break;
+        }
+        out[n] = (char32_t)c;
+    }
+    *len -= n * sizeof(char32_t);
+    *dst += n * sizeof(char32_t);
+    *count = n;
+    if (n < total) {
+        errno = EILSEQ;
+        return (size_t)-1;
+    }
+    return 0;
+}
+
+/**
+ * Copy well-formed UTF-32 text, checking it along the way.
+ *
+ * - parameter cd: The conversion descriptor.
+ * - parameter d: The UTF-32 decoder.
+ * - parameter src: The source buffer to read UTF-32 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the `src` buffer.
+ * - parameter dst: The destination buffer to copy the text to, or `NULL` to
+ *   only measure it.
+ * - parameter dstleft: The amount of bytes left in the `dst` buffer.
+ * - parameter pending: The location to store a code point that was read from
+ *   the `src` buffer, but couldn't be written to the `dst` buffer.
+ * - parameter has_pending: Set to `true` when `pending` is set.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * Runs of valid code units are found with ``bib_iconv_scan_utf32_scalar``
+ * and copied as a whole, and the code unit that stops a run is checked with
+ * ``utf32_read``.
+ */
+static inline size_t utf32_passthrough(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                       char const **restrict src,
+                                       size_t *restrict srcleft,
+                                       char **restrict dst,
+                                       size_t *restrict dstleft,
+                                       ucs4_t *restrict pending,
+                                       bool *restrict has_pending) {
+    while (true) {
+        size_t length = BIB_ICONV_SPAN_SIZE;
+        if (length > *dstleft) {
+            length = *dstleft;
+        }
+        if (length > *srcleft) {
+            length = *srcleft;
+        }
+        length /= sizeof(char32_t);
+        size_t const run = bib_iconv_scan_utf32_scalar(*src, length)
+                         * sizeof(char32_t);
+        if (run > 0) {
+            if (dst != nullptr) {
+                memcpy(*dst, *src, run);
+                *dst += run;
+            }
+            *src += run;
+            *srcleft -= run;
+            *dstleft -= run;
+            if (*dstleft == 0) {
+                return 0;
+            }
+        }
+
+        char const *const start = *src;
+        ucs4_t uni = 0;
+        if (utf32_read(cd, d, src, srcleft, &uni) == (size_t)-1) {
+            return (size_t)-1;
+        }
+        size_t const size = sizeof(char32_t);
+        if (size > *dstleft) {
+            *pending = uni;
+            *has_pending = true;
+            errno = E2BIG;
+            return (size_t)-1;
+        }
+        if (dst != nullptr) {
+            memcpy(*dst, start, size);
+            *dst += size;
+        }
+        *dstleft -= size;
+        if (uni == 0 || *dstleft == 0) {
+            return 0;
+        }
+    }
+}
+
+size_t bib_iconv_convert_utf32_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        char **restrict dst,
+                                        size_t *restrict dstleft,
+                                        ucs4_t *restrict pending,
+                                        bool *restrict has_pending) {
+    return utf32_passthrough(cd, d, src, srcleft, dst, dstleft,
+                             pending, has_pending);
+}
+
+size_t bib_iconv_measure_utf32_to_utf32(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                        char const **restrict src,
+                                        size_t *restrict srcleft,
+                                        size_t *restrict size) {
+    size_t dstleft = SIZE_MAX;
+    ucs4_t pending = 0;
+    bool has_pending = false;
+    size_t const result = utf32_passthrough(cd, d, src, srcleft, nullptr,
+                                            &dstleft, &pending, &has_pending);
+    *size = SIZE_MAX - dstleft;
+    return result;
+}
 
 void bib_iconv_open_utf32_encoder(bib_iconv_encoder_t e) {
     e->context = nullptr;
     e->init = nullfun;
     e->write = utf32_write;
+    e->write_block = utf32_write_block;
     e->flush = nullfun;
     e->deinit = nullfun;
 }
 
 void bib_iconv_open_utf32_decoder(bib_iconv_decoder_t d) {
     d->context = nullptr;
+    d->context_size = 0;
     d->init = nullfun;
     d->read = utf32_read;
+    d->read_block = utf32_read_block;
+    d->save = nullfun;
+    d->restore = nullfun;
     d->deinit = nullfun;
 }
@@ -6,7 +6,9 @@
 #include "cfeatures.h"
 #include "chartypes.h"
 #include "iconv_coding.h"
+#include "runscan.h"
 #include <string.h>
+#include <stdint.h>
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
@@ -17,62 +19,98 @@
 #define nullfun ((uintptr_t)0)
 #endif
 
-static size_t utf8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
-                        char const **restrict src, size_t *restrict srcleft,
-                        ucs4_t *unicode) {
-    assert(cd != nullptr);
-    assert(d != nullptr);
-    assert(src != nullptr);
-    assert(*src != nullptr);
-    assert(srcleft != nullptr);
-    assert(unicode != nullptr);
-
-    if (*srcleft == 0) {
-        errno = EINVAL;
-        return (size_t)-1;
-    }
-
-    char8_t first_byte = **src;
+/**
+ * Read one well-formed UTF-8 character.
+ *
+ * - parameter src: The UTF-8 encoded character to read.
+ * - parameter srcleft: The amount of bytes left in the `src` buffer.
+ * - parameter unicode: The location to store the character's code point.
+ * - returns: The amount of bytes in the character, or `(size_t)-1` on failure.
+ *
+ * Overlong encodings, surrogates, and code points past `U+10FFFF` are
+ * rejected with `EILSEQ`, so every UTF-8 source is checked the same way no
+ * matter which encoding it's converted to. A character cut short by the end
+ * of the buffer fails with `EINVAL`, unless the bytes that are there already
+ * can't start a well-formed character.
+ */
+static size_t utf8_read_scalar(char const *src, size_t srcleft,
+                               ucs4_t *restrict unicode) {
+    char8_t const first_byte = src[0];
     size_t expected_length = 0;
+    /* The range of the second byte, which rules out overlong encodings,
+     * surrogates, and code points past `U+10FFFF`. */
+    char8_t low = 0x80;
+    char8_t high = 0xBF;
     ucs4_t result = 0;
-
     if (first_byte < 0x80) {
-        expected_length = 1;
-        result = first_byte;
-    } else if ((first_byte & 0xE0) == 0xC0) {
+        *unicode = first_byte;
+        return 1;
+    } else if (first_byte >= 0xC2 && first_byte <= 0xDF) {
         expected_length = 2;
         result = first_byte & 0x1F;
-    } else if ((first_byte & 0xF0) == 0xE0) {
+    } else if (first_byte >= 0xE0 && first_byte <= 0xEF) {
         expected_length = 3;
         result = first_byte & 0x0F;
-    } else if ((first_byte & 0xF8) == 0xF0) {
+        if (first_byte == 0xE0) {
+            low = 0xA0;
+        } else if (first_byte == 0xED) {
+            high = 0x9F;
+        }
+    } else if (first_byte >= 0xF0 && first_byte <= 0xF4) {
         expected_length = 4;
         result = first_byte & 0x07;
+        if (first_byte == 0xF0) {
+            low = 0x90;
+        } else if (first_byte == 0xF4) {
+            high = 0x8F;
+        }
     } else {
         errno = EILSEQ;
         return (size_t)-1;
     }
 
-    if (*srcleft < expected_length) {
-        errno = EINVAL;
-        return (size_t)-1;
-    }
-
-    for (size_t i = 1; i < expected_length; i++) {
-        char8_t byte = (*src)[i];
-        if ((byte & 0xC0) != 0x80) {
+    for (size_t i = 1; i < expected_length; i += 1) {
+        if (i == srcleft) {
+            errno = EINVAL;
+            return (size_t)-1;
+        }
+        char8_t const byte = src[i];
+        if (byte < low || byte > high) {
             errno = EILSEQ;
             return (size_t)-1;
         }
+        low = 0x80;
+        high = 0xBF;
         result = (result << 6) | (byte & 0x3F);
     }
-
     *unicode = result;
-    *src += expected_length;
-    *srcleft -= expected_length;
     return expected_length;
 }
 
+static size_t utf8_read(bib_iconv_t cd, bib_iconv_decoder_t d,
+                        char const **restrict src, size_t *restrict srcleft,
+                        ucs4_t *unicode) {
+    assert(cd != nullptr);
+    assert(d != nullptr);
+    assert(src != nullptr);
+    assert(*src != nullptr);
+    assert(srcleft != nullptr);
+    assert(unicode != nullptr);
+
+    if (*srcleft == 0) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+
+    size_t const length = utf8_read_scalar(*src, *srcleft, unicode);
+    if (length == (size_t)-1) {
+        return length;
+    }
+    *src += length;
+    *srcleft -= length;
+    return length;
+}
+
 static size_t utf8_write(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
                          ucs4_t c, char **restrict dst, size_t *restrict len) {
     assert(dst != nullptr);
@@ -125,17 +163,214 @@ static size_t utf8_write(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
     return (size_t)-1;
 }
 
+static size_t utf8_read_block(bib_iconv_t cd, bib_iconv_decoder_t d,
+                              char const **restrict src,
+                              size_t *restrict srcleft,
+                              ucs4_t *restrict block, size_t *restrict count) {
+    assert(count != nullptr);
+    size_t const capacity = *count;
+    size_t n = 0;
+    while (n < capacity) {
+        if (utf8_read(cd, d, src, srcleft, &block[n]) == (size_t)-1) {
+            *count = n;
+            return (size_t)-1;
+        }
+        n += 1;
+        if (block[n - 1] == 0) {
+            /* A null character ends the conversion. */
+            break;
+        }
+    }
+    *count = n;
+    return 0;
+}
+
+static size_t utf8_write_block(bib_iconv_t cd, struct bib_iconv_encoder_s *e,
+                               ucs4_t const *restrict block,
+                               size_t *restrict count,
+                               char **restrict dst, size_t *restrict len) {
+    (void)cd;
+    (void)e;
+    assert(count != nullptr);
+    assert(dst != nullptr);
+    assert(*dst != nullptr);
+    assert(len != nullptr);
+    size_t const total = *count;
+    if (*len / BIB_ICONV_MAX_WRITE_SIZE < total) {
+        *count = 0;
+        errno = E2BIG;
+        return (size_t)-1;
+    }
+    /* The whole block fits, so each code point is written without checking
+     * the remaining space in the destination buffer. */
+    char8_t *out = (char8_t *)*dst;
+    size_t n = 0;
+    for (; n < total; n += 1) {
+        ucs4_t c = block[n];
+        if (c <= 0x7F) {
+            out[0] = (char8_t)c;
+            out += 1;
+        } else if (c <= 0x7FF) {
+            out[0] = (char8_t)(0xC0 | (c >> 6));
+            out[1] = (char8_t)(0x80 | (c & 0x3F));
+            out += 2;
+        } else if (c <= 0xFFFF) {
+            out[0] = (char8_t)(0xE0 | (c >> 12));
+            out[1] = (char8_t)(0x80 | ((c >> 6) & 0x3F));
+            out[2] = (char8_t)(0x80 | (c & 0x3F));
+            out += 3;
+        } else if (c <= 0x10FFFF) {
+            out[0] = (char8_t)(0xF0 | (c >> 18));
+            out[1] = (char8_t)(0x80 | ((c >> 12) & 0x3F));
+            out[2] = (char8_t)(0x80 | ((c >> 6) & 0x3F));
+            out[3] = (char8_t)(0x80 | (c & 0x3F));
+            out += 4;
+        } else {
+            break;
+        }
+    }
+    *len -= (char *)out - *dst;
+    *dst = (char *)out;
+    *count = n;
+    if (n < total) {
+        errno = EINVAL;
+        return (size_t)-1;
+    }
+    return 0;
+}
+
+/**
+ * Copy well-formed UTF-8 text, checking it along the way.
+ *
+ * - parameter src: The source buffer to read UTF-8 encoded data from.
+ * - parameter srcleft: The amount of bytes left in the `src` buffer.
+ * - parameter dst: The destination buffer to copy the text to, or `NULL` to
+ *   only measure it.
+ * - parameter dstleft: The amount of bytes left in the `dst` buffer.
+ * - parameter pending: The location to store a code point that was read from
+ *   the `src` buffer, but couldn't be written to the `dst` buffer.
+ * - parameter has_pending: Set to `true` when `pending` is set.
+ * - returns: `0` upon a successful conversion, and `(size_t)-1` on failure.
+ *
+ * Runs of ASCII characters are found with ``bib_iconv_scan_utf8_ascii``, and
+ * every other character is checked on its own. Each span of well-formed text
+ * is then copied as a whole. An ill-formed sequence stops the copy with
+ * `EILSEQ`, leaving `src` at its first byte.
+ */
+static inline size_t utf8_passthrough(char const **restrict src,
+                                      size_t *restrict srcleft,
+                                      char **restrict dst,
+                                      size_t *restrict dstleft,
+                                      ucs4_t *restrict pending,
+                                      bool *restrict has_pending) {
+    while (true) {
+        /* Check as much of the source buffer as fits in the destination
+         * buffer, up to and including a null character. */
+        size_t length = BIB_ICONV_SPAN_SIZE;
+        if (length > *dstleft) {
+            length = *dstleft;
+        }
+        if (length > *srcleft) {
+            length = *srcleft;
+        }
+        size_t span = 0;
+        bool is_null = false;
+        while (span < length) {
+            char8_t const c = (*src)[span];
+            if (c >= 0x80) {
+                ucs4_t uni = 0;
+                size_t const size = utf8_read_scalar(*src + span,
+                                                     length - span, &uni);
+                if (size == (size_t)-1) {
+                    break;
+                }
+                span += size;
+            } else if (c == 0) {
+                span += 1;
+                is_null = true;
+                break;
+            } else {
+                span += bib_iconv_scan_utf8_ascii(*src + span, length - span);
+            }
+        }
+        if (span > 0) {
+            if (dst != nullptr) {
+                memcpy(*dst, *src, span);
+                *dst += span;
+            }
+            *src += span;
+            *srcleft -= span;
+            *dstleft -= span;
+            if (is_null || *dstleft == 0) {
+                return 0;
+            }
+        }
+
+        /* The next character is ill-formed, cut short, doesn't fit, or just
+         * starts the next span. */
+        if (*srcleft == 0) {
+            errno = EINVAL;
+            return (size_t)-1;
+        }
+        ucs4_t uni = 0;
+        size_t const size = utf8_read_scalar(*src, *srcleft, &uni);
+        if (size == (size_t)-1) {
+            return size;
+        }
+        if (size > *dstleft) {
+            *src += size;
+            *srcleft -= size;
+            *pending = uni;
+            *has_pending = true;
+            errno = E2BIG;
+            return (size_t)-1;
+        }
+    }
+}
+
+size_t bib_iconv_convert_utf8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                      char const **restrict src,
+                                      size_t *restrict srcleft,
+                                      char **restrict dst,
+                                      size_t *restrict dstleft,
+                                      ucs4_t *restrict pending,
+                                      bool *restrict has_pending) {
+    (void)cd;
+    (void)d;
+    return utf8_passthrough(src, srcleft, dst, dstleft, pending, has_pending);
+}
+
+size_t bib_iconv_measure_utf8_to_utf8(bib_iconv_t cd, bib_iconv_decoder_t d,
+                                      char const **restrict src,
+                                      size_t *restrict srcleft,
+                                      size_t *restrict size) {
+    (void)cd;
+    (void)d;
+    size_t dstleft = SIZE_MAX;
+    ucs4_t pending = 0;
+    bool has_pending = false;
+    size_t const result = utf8_passthrough(src, srcleft, nullptr, &dstleft,
+                                           &pending, &has_pending);
+    *size = SIZE_MAX - dstleft;
+    return result;
+}
+
 void bib_iconv_open_utf8_encoder(bib_iconv_encoder_t e) {
     e->context = nullptr;
     e->init = nullfun;
     e->write = utf8_write;
+    e->write_block = utf8_write_block;
     e->flush = nullfun;
     e->deinit = nullfun;
 }
 
 void bib_iconv_open_utf8_decoder(bib_iconv_decoder_t d) {
     d->context = nullptr;
+    d->context_size = 0;
     d->init = nullfun;
     d->read = utf8_read;
+    d->read_block = utf8_read_block;
+    d->save = nullfun;
+    d->restore = nullfun;
     d->deinit = nullfun;
 }
@@ -6,15 +6,50 @@
 //
 
 #import <XCTest/XCTest.h>
+#import <malloc/malloc.h>
 #import <bibiconv/bibiconv.h>
 #import <bibiconv/codetable.h>
 #import <bibiconv/marc8_tables.h>
 #import "marc8_table_macros.h"
+#import "codetable_walk.h"
 
 @interface bibiconv_tests : XCTestCase
 
 @end
 
+/* A per-request arena, used as an allocator for converted text. */
+struct arena {
+    _Alignas(max_align_t) char bytes[4096];
+    size_t used;
+    size_t allocations;
+    size_t deallocations;
+    size_t last_size;
+};
+
+static void *arena_allocate(void *context, size_t size) {
+    struct arena *arena = context;
+    arena->last_size = size;
+    /* Keep every allocation aligned for any type. */
+    size = (size + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1);
+    if (sizeof(arena->bytes) - arena->used < size) {
+        return NULL;
+    }
+    arena->allocations += 1;
+    arena->used += size;
+    return arena->bytes + arena->used - size;
+}
+
+static void arena_deallocate(void *context, void *pointer) {
+    struct arena *arena = context;
+    arena->deallocations += 1;
+}
+
+/* An executor that runs work on Grand Central Dispatch's worker threads. */
+static void dispatch_apply_auto(size_t count, void *context, void *argument,
+                                void (*work)(void *argument, size_t index)) {
+    dispatch_apply_f(count, DISPATCH_APPLY_AUTO, argument, work);
+}
+
 @implementation bibiconv_tests
 
 - (void)testBasicLatinSuccess {
@@ -145,6 +180,99 @@
     XCTAssertFalse(is_combining);
 }
 
+- (void)testCharsetWalkReturnsStatusWithoutSettingErrno {
+    errno = 0;
+    size_t location = 0;
+    bib_iconv_code_point_t code_point = { 0 };
+    char const input[4] = { 0xA1, 0x2F, 0x30, 0x00 };
+    XCTAssertEqual(bib_iconv_charset_walk(&bib_iconv_marc8_eacc, 2, input,
+                                          &location, &code_point), EILSEQ);
+    XCTAssertEqual(location, 0);
+    XCTAssertEqual(bib_iconv_charset_walk(&bib_iconv_marc8_eacc, 3, input,
+                                          &location, &code_point), 0);
+    XCTAssertEqual(location, 3);
+    XCTAssertEqual(code_point.unicode, 0x3007);
+    XCTAssertFalse(code_point.is_combining);
+    XCTAssertEqual(bib_iconv_charset_walk(&bib_iconv_marc8_eacc, 3, input,
+                                          &location, &code_point), EINVAL);
+    XCTAssertEqual(location, 3);
+    XCTAssertEqual(errno, 0);
+}
+
+/**
+ * Measure looking up every assigned EACC character in a character set.
+ *
+ * Divide the measured time by the amount of assigned EACC characters, about
+ * sixteen thousand, to get the cost of looking up each character.
+ */
+- (void)measureEACCLookupWithCharset:(bib_iconv_charset_t const *)charset {
+    NSMutableData *codes = [NSMutableData data];
+    for (int first = 0x21; first < 0x7F; first += 1) {
+        for (int second = 0x21; second < 0x7F; second += 1) {
+            for (int third = 0x21; third < 0x7F; third += 1) {
+                char const code[3] = { (char)first, (char)second, (char)third };
+                size_t location = 0;
+                if (bib_iconv_charset_lookup(charset, 3, code, &location,
+                                             nullptr, nullptr)) {
+                    [codes appendBytes:code length:3];
+                }
+            }
+        }
+    }
+    char const *input = codes.bytes;
+    size_t const length = codes.length;
+    [self measureBlock:^{
+        for (size_t location = 0; location < length;) {
+            ucs4_t unicode = 0;
+            bool is_combining = false;
+            bib_iconv_charset_lookup(charset, length, input, &location,
+                                     &unicode, &is_combining);
+        }
+    }];
+}
+
+- (void)testEACCIndexedLookupPerformance {
+    [self measureEACCLookupWithCharset:&bib_iconv_marc8_eacc];
+}
+
+- (void)testEACCLinearLookupPerformance {
+    /* Without the index, graphic maps are searched one entry at a time. */
+    struct bib_iconv_charset linear = bib_iconv_marc8_eacc;
+    linear.code_occupancy = nullptr;
+    [self measureEACCLookupWithCharset:&linear];
+}
+
+- (void)testEACCIndexedLookupMatchesLinearLookup {
+    struct bib_iconv_charset linear = bib_iconv_marc8_eacc;
+    linear.code_occupancy = nullptr;
+    for (int first = 0x20; first < 0x80; first += 1) {
+        for (int second = 0x00; second < 0x100; second += 1) {
+            for (int third = 0x00; third < 0x100; third += 1) {
+                char const code[3] = { (char)first, (char)second, (char)third };
+                size_t indexed_location = 0;
+                size_t linear_location = 0;
+                ucs4_t indexed_unicode = 0;
+                ucs4_t linear_unicode = 0;
+                bool indexed_result =
+                    bib_iconv_charset_lookup(&bib_iconv_marc8_eacc, 3, code,
+                                             &indexed_location,
+                                             &indexed_unicode, nullptr);
+                bool linear_result =
+                    bib_iconv_charset_lookup(&linear, 3, code,
+                                             &linear_location,
+                                             &linear_unicode, nullptr);
+                if (indexed_result != linear_result
+                    || indexed_location != linear_location
+                    || indexed_unicode != linear_unicode) {
+                    XCTFail("Lookup mismatch for 0x%02X%02X%02X",
+                            first, second, third);
+                    return;
+                }
+            }
+        }
+    }
+}
+
 - (void)testIconvBasicLatinSuccess {
     bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
     XCTAssertNotEqual(cd, (bib_iconv_t)-1);
@@ -205,6 +333,78 @@
     bib_iconv_close(cd);
 }
 
+- (void)testIconvUTF8ToUTF8StopsAtIllFormedSequences {
+    /* Overlong encodings and encoded surrogates are rejected, leaving the
+     * source buffer at the first byte of the ill-formed sequence. */
+    struct {
+        char const *from;
+        size_t offset;
+        int error;
+    } const cases[] = {
+        { "abc\xC0\xAF" "def", 3, EILSEQ }, { "ab\xED\xA0\x80", 2, EILSEQ },
+        { "\xF4\x90\x80\x80", 0, EILSEQ }, { "Caf\xC3", 3, EINVAL },
+    };
+    for (size_t index = 0; index < sizeof(cases) / sizeof(*cases);
+         index += 1) {
+        bib_iconv_t cd = bib_iconv_open("UTF-8", "UTF-8");
+        char const *src = cases[index].from;
+        size_t srclen = strlen(src);
+        char destination[16] = { 0 };
+        char *dst = destination;
+        size_t dstlen = sizeof(destination);
+        errno = 0;
+        XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+        XCTAssertEqual(errno, cases[index].error);
+        XCTAssertEqual(src, cases[index].from + cases[index].offset);
+        XCTAssertEqual(dst, destination + cases[index].offset);
+        XCTAssertEqual(strncmp(destination, cases[index].from,
+                               cases[index].offset), 0);
+        bib_iconv_close(cd);
+    }
+
+    bib_iconv_t cd = bib_iconv_open("UTF-16", "UTF-16");
+    char16_t const from[] = { u'a', 0xDC00, u'b' };
+    char const *src = (char const *)from;
+    size_t srclen = sizeof(from);
+    char16_t destination[4] = { 0 };
+    char *dst = (char *)destination;
+    size_t dstlen = sizeof(destination);
+    errno = 0;
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+    XCTAssertEqual(errno, EILSEQ);
+    XCTAssertEqual(src, (char const *)(from + 1));
+    XCTAssertEqual(destination[0], u'a');
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvUTF8ToUTF16AndUTF32StopsAtIllFormedSequences {
+    /* UTF-8 is checked the same way whichever encoding it's converted to, so
+     * an overlong null can't end the conversion early. */
+    char const *const cases[] = {
+        "a\xC0\x80z", "a\xE0\x80\xAFz", "a\xED\xA0\x80z",
+        "a\xF4\x90\x80\x80z",
+    };
+    char const *const encodings[] = { "UTF-16", "UTF-32" };
+    for (size_t index = 0; index < sizeof(cases) / sizeof(*cases);
+         index += 1) {
+        for (size_t to = 0; to < sizeof(encodings) / sizeof(*encodings);
+             to += 1) {
+            bib_iconv_t cd = bib_iconv_open(encodings[to], "UTF-8");
+            char const *src = cases[index];
+            size_t srclen = strlen(src);
+            char32_t destination[8] = { 0 };
+            char *dst = (char *)destination;
+            size_t dstlen = sizeof(destination);
+            errno = 0;
+            XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen),
+                           (size_t)-1, @"%s", encodings[to]);
+            XCTAssertEqual(errno, EILSEQ, @"%s", encodings[to]);
+            XCTAssertEqual(src, cases[index] + 1, @"%s", encodings[to]);
+            bib_iconv_close(cd);
+        }
+    }
+}
+
 - (void)testIconvMARC8ToUTF8 {
     bib_iconv_t cd = bib_iconv_open("utf8", "marc8");
     XCTAssertNotEqual(cd, (bib_iconv_t)-1);
@@ -220,6 +420,879 @@
     bib_iconv_close(cd);
 }
 
+/**
+ * Convert a record with a conversion descriptor, then flush it for the next
+ * record.
+ *
+ * - returns: The converted record.
+ */
+- (NSString *)convertRecord:(char const *)record with:(bib_iconv_t)cd {
+    char const *src = record;
+    size_t srclen = strlen(record) + 1;
+    char destination[64] = { 0 };
+    char *dst = destination;
+    size_t dstlen = sizeof(destination);
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), 0);
+    XCTAssertEqual(bib_iconv(cd, nullptr, nullptr, &dst, &dstlen), 0);
+    return [NSString stringWithUTF8String:destination];
+}
+
+- (void)testIconvMARC8RecordDelimitersToUTF16 {
+    /* Terminators and subfield delimiters are copied along with the ASCII
+     * text around them, both before and right after an escape sequence. */
+    bib_iconv_t cd = bib_iconv_open("UTF-16", "MARC-8");
+    char const from[] = "\x1F" "aSmith,\x1E\eb2\e(B\x1F" "d1900.\x1E\x1D";
+    char const *src = from;
+    size_t srclen = strlen(from);
+    char16_t destination[32] = { 0 };
+    char *dst = (char *)destination;
+    size_t dstlen = sizeof(destination);
+    errno = 0;
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+    XCTAssertEqual(srclen, 0);
+    char16_t const expected[] = u"\x1F" "aSmith,\x1E\u2082\x1F" "d1900.\x1E\x1D";
+    XCTAssertEqual(memcmp(destination, expected, sizeof(expected)), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8ReusesContextAcrossRecords {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    /* Each record starts over with the initial working set, no matter which
+     * character sets the previous record ended with. */
+    XCTAssertEqualObjects([self convertRecord:"\e(N\x41\e)Q\xC1" with:cd],
+                          @"\u0430\u0452");
+    XCTAssertEqualObjects([self convertRecord:"\x41\xC1" with:cd], @"A\u2113");
+    XCTAssertEqualObjects([self convertRecord:"\e$1\x21\x30\x21" with:cd],
+                          @"\u4E00");
+    XCTAssertEqualObjects([self convertRecord:"\x41" with:cd], @"A");
+
+    /* After the first record, converting more records doesn't allocate. */
+    malloc_statistics_t before = { 0 };
+    malloc_zone_statistics(nullptr, &before);
+    for (int count = 0; count < 1000; count += 1) {
+        char const *src = "\e(N\x41\e)Q\xC1\e$1\x21\x30\x21";
+        size_t srclen = strlen(src) + 1;
+        char destination[64];
+        char *dst = destination;
+        size_t dstlen = sizeof(destination);
+        bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+        bib_iconv(cd, nullptr, nullptr, &dst, &dstlen);
+    }
+    malloc_statistics_t after = { 0 };
+    malloc_zone_statistics(nullptr, &after);
+    XCTAssertEqual(after.blocks_in_use, before.blocks_in_use);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8ToUTF8NFC {
+    bib_iconv_t cd = bib_iconv_open("UTF-8//NFC", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    /* Diacritics are composed with the characters they modify. */
+    XCTAssertEqualObjects([self convertRecord:"Caf\xE2" "e" with:cd],
+                          @"Caf\u00E9");
+    XCTAssertEqualObjects([self convertRecord:"\xE2\xE8u" with:cd],
+                          @"\u01D8");
+    XCTAssertEqualObjects([self convertRecord:"\e(S\x22\x41\x3F" with:cd],
+                          @"\u0386;");
+    /* Diacritics without a precomposed form stay combining characters. */
+    XCTAssertEqualObjects([self convertRecord:"\xE2q" with:cd], @"q\u0301");
+    /* Letters with a horn are decomposed, so that a cedilla or an ogonek is
+     * composed with the letter before the horn is. */
+    XCTAssertEqualObjects([self convertRecord:"\xF1\xAD" with:cd],
+                          @"\u0172\u031B");
+    XCTAssertEqualObjects([self convertRecord:"\xF0\xBC" with:cd],
+                          @"\u01A1\u0327");
+    XCTAssertEqualObjects([self convertRecord:"\xE2\xAD" with:cd],
+                          @"\u1EE8");
+    bib_iconv_close(cd);
+
+    /* Only text decoded from MARC-8 can be composed. */
+    errno = 0;
+    XCTAssertEqual(bib_iconv_open("UTF-8//NFC", "UTF-8"), (bib_iconv_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+    errno = 0;
+    XCTAssertEqual(bib_iconv_open("UTF-8//NFD", "MARC-8"), (bib_iconv_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+}
+
+- (void)testIconvMARC8ToUTF8CanonicalOrder {
+    bib_iconv_t cd = bib_iconv_open("UTF-8//CANONICAL", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    /* Stacked diacritics are sorted by their combining classes, no matter
+     * which order they're in. */
+    XCTAssertEqualObjects([self convertRecord:"\xF2\xE3" "e" with:cd],
+                          @"e\u0323\u0302");
+    XCTAssertEqualObjects([self convertRecord:"\xE3\xF2" "e" with:cd],
+                          @"e\u0323\u0302");
+    /* Diacritics with the same combining class keep their order. */
+    XCTAssertEqualObjects([self convertRecord:"\xE2\xE8u" with:cd],
+                          @"u\u0308\u0301");
+    bib_iconv_close(cd);
+
+    /* Diacritics are sorted before they're composed. */
+    cd = bib_iconv_open("UTF-8//NFC", "MARC-8");
+    XCTAssertEqualObjects([self convertRecord:"\xF2\xE3" "e" with:cd],
+                          @"\u1EC7");
+    XCTAssertEqualObjects([self convertRecord:"\xE3\xF2" "e" with:cd],
+                          @"\u1EC7");
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvInitInCallerStorage {
+    /* The storage doesn't need to be aligned. */
+    unsigned char storage[BIB_ICONV_STORAGE_SIZE + 1];
+    bib_iconv_t cd = bib_iconv_init(storage + 1, BIB_ICONV_STORAGE_SIZE,
+                                    "UTF-8", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    XCTAssertEqualObjects([self convertRecord:"Caf\xE2" "e" with:cd],
+                          @"Cafe\u0301");
+    XCTAssertEqualObjects([self convertRecord:"\e$1\x21\x30\x21" with:cd],
+                          @"\u4E00");
+    XCTAssertEqual(bib_iconv_close(cd), 0);
+
+    /* Creating, using, and closing the descriptor doesn't allocate. */
+    malloc_statistics_t before = { 0 };
+    malloc_zone_statistics(nullptr, &before);
+    cd = bib_iconv_init(storage, sizeof(storage), "UCS-2", "MARC-8");
+    char const *src = "\e(N\x41\e)Q\xC1\e$1\x21\x30\x21";
+    size_t srclen = strlen(src) + 1;
+    char destination[64];
+    char *dst = destination;
+    size_t dstlen = sizeof(destination);
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), 0);
+    bib_iconv_close(cd);
+    malloc_statistics_t after = { 0 };
+    malloc_zone_statistics(nullptr, &after);
+    XCTAssertEqual(after.blocks_in_use, before.blocks_in_use);
+
+    errno = 0;
+    XCTAssertEqual(bib_iconv_init(storage, 64, "UTF-8", "MARC-8"),
+                   (bib_iconv_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+}
+
+- (void)testIconvResetDiscardsState {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    /* Stop in the middle of a record, in the Cyrillic character set with a
+     * combining character waiting for the character it modifies. */
+    char const *src = "\e(N\x41\e)Q\xE2";
+    size_t srclen = strlen(src);
+    char destination[64] = { 0 };
+    char *dst = destination;
+    size_t dstlen = sizeof(destination);
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+    XCTAssertEqual(bib_iconv_reset(cd), 0);
+    XCTAssertEqualObjects([self convertRecord:"\x41\xC1" with:cd], @"A\u2113");
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvPoolReusesDescriptors {
+    bib_iconv_pool_t pool = bib_iconv_pool_create();
+    bib_iconv_t cd = bib_iconv_pool_acquire(pool, "UTF-8", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    char const *src = "\e(N\x41";
+    size_t srclen = strlen(src);
+    char destination[64] = { 0 };
+    char *dst = destination;
+    size_t dstlen = sizeof(destination);
+    bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+    XCTAssertEqual(bib_iconv_pool_release(pool, cd), 0);
+
+    /* The released descriptor is reused, starting over from its initial
+     * state, and other encodings get their own descriptors. */
+    XCTAssertEqual(bib_iconv_pool_acquire(pool, "UTF-8", "MARC-8"), cd);
+    XCTAssertEqualObjects([self convertRecord:"\x41" with:cd], @"A");
+    bib_iconv_t other = bib_iconv_pool_acquire(pool, "UCS-2", "MARC-8");
+    XCTAssertNotEqual(other, cd);
+    XCTAssertEqual(bib_iconv_pool_release(pool, other), 0);
+    XCTAssertEqual(bib_iconv_pool_release(pool, cd), 0);
+
+    /* Different names for the same encodings share idle descriptors. */
+    XCTAssertEqual(bib_iconv_pool_acquire(pool, "utf8", "ANSEL"), cd);
+    XCTAssertEqual(bib_iconv_pool_release(pool, cd), 0);
+
+    /* Only descriptors acquired from the pool can be released into it. */
+    bib_iconv_t opened = bib_iconv_open("UTF-8", "MARC-8");
+    errno = 0;
+    XCTAssertEqual(bib_iconv_pool_release(pool, opened), -1);
+    XCTAssertEqual(errno, EINVAL);
+    bib_iconv_close(opened);
+    bib_iconv_pool_destroy(pool);
+}
+
+- (void)testEncodingNames {
+    struct {
+        char const *name;
+        bib_iconv_encoding_t encoding;
+    } const cases[] = {
+        { "MARC-8", BIB_ICONV_MARC8 }, { "marc8", BIB_ICONV_MARC8 },
+        { "ANSEL", BIB_ICONV_MARC8 }, { "Z39.47", BIB_ICONV_MARC8 },
+        { "ANSI/NISO Z39.47", BIB_ICONV_MARC8 }, { "UTF-8", BIB_ICONV_UTF8 },
+        { "utf_8", BIB_ICONV_UTF8 }, { "", BIB_ICONV_UTF8 },
+        { "UTF-16", BIB_ICONV_UTF16 }, { "UCS-2", BIB_ICONV_UTF16 },
+        { "UTF-32", BIB_ICONV_UTF32 }, { "wchar_t", BIB_ICONV_UTF32 },
+        { "UTF=16", BIB_ICONV_UNKNOWN }, { "Latin-1", BIB_ICONV_UNKNOWN },
+        { "MARC-8 and a much longer name", BIB_ICONV_UNKNOWN },
+    };
+    for (size_t index = 0; index < sizeof(cases) / sizeof(*cases); index += 1) {
+        XCTAssertEqual(bib_iconv_encoding(cases[index].name),
+                       cases[index].encoding, @"%s", cases[index].name);
+    }
+}
+
+- (void)testIconvOpenId {
+    bib_iconv_t cd = bib_iconv_open_id(BIB_ICONV_UTF8, BIB_ICONV_MARC8);
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    XCTAssertEqualObjects([self convertRecord:"Caf\xE2" "e" with:cd],
+                          @"Cafe\u0301");
+    bib_iconv_close(cd);
+
+    /* "UTF-16" names the same encoding as "UCS-2" when converting to it. */
+    cd = bib_iconv_open("UTF-16", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    bib_iconv_close(cd);
+
+    errno = 0;
+    XCTAssertEqual(bib_iconv_open_id(BIB_ICONV_MARC8, BIB_ICONV_UTF8),
+                   (bib_iconv_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+}
+
+- (void)testIconvMeasureMatchesConversion {
+    struct { char const *to, *from, *text; } const cases[] = {
+        { "UTF-8", "MARC-8", "Caf\xE2" "e, \e(N\x50\x52\e(B \e$1\x21\x30\x21" },
+        { "UCS-2", "MARC-8", "\e)Q\xC1\e)!E\xE1" "a plain ASCII text" },
+        { "UTF-32", "MARC-8", "Plain ASCII text\x00 after the end" },
+        { "UCS-2", "UTF-8", "Caf\u00E9 \U0001F600" },
+    };
+    for (size_t index = 0; index < sizeof(cases) / sizeof(*cases); index += 1) {
+        bib_iconv_t cd = bib_iconv_open(cases[index].to, cases[index].from);
+        XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+        size_t const srclen = strlen(cases[index].text) + 1;
+        size_t measured = 0;
+        XCTAssertEqual(bib_iconv_measure(cd, cases[index].text, srclen,
+                                         &measured), 0);
+        char destination[256] = { 0 };
+        char const *src = cases[index].text;
+        size_t srcleft = srclen;
+        char *dst = destination;
+        size_t dstleft = sizeof(destination);
+        XCTAssertEqual(bib_iconv(cd, &src, &srcleft, &dst, &dstleft), 0);
+        XCTAssertEqual(measured, sizeof(destination) - dstleft);
+        bib_iconv_close(cd);
+    }
+}
+
+- (void)testIconvMeasureFailure {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    size_t measured = 0;
+    errno = 0;
+    XCTAssertEqual(bib_iconv_measure(cd, "ab\e)Zc", 7, &measured), (size_t)-1);
+    XCTAssertEqual(errno, EILSEQ);
+    XCTAssertEqual(measured, 2);
+    /* A string ending in combining characters is missing the character they
+     * modify. */
+    errno = 0;
+    XCTAssertEqual(bib_iconv_measure(cd, "ab\xE1", 3, &measured), (size_t)-1);
+    XCTAssertEqual(errno, EINVAL);
+    XCTAssertEqual(measured, 2);
+    /* The source string doesn't need to be null-terminated. */
+    XCTAssertEqual(bib_iconv_measure(cd, "ab\xE1" "c", 4, &measured), 0);
+    XCTAssertEqual(measured, 5);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvSeekWithIndex {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    char const from[] = "Caf\xE2" "e \e(N\x50\x52\x53\e(B tail";
+    bib_iconv_index_t index = bib_iconv_index_create(cd, from, sizeof(from),
+                                                     4);
+    XCTAssertNotEqual(index, nullptr);
+    /* The slice is converted with the Cyrillic character set selected by the
+     * escape sequence before it. */
+    XCTAssertEqual(bib_iconv_seek(cd, index, from, 10), 0);
+    XCTAssertEqualObjects([self convertRecord:from + 10 with:cd],
+                          @"\u0440\u0441 tail");
+    XCTAssertEqual(bib_iconv_seek(cd, index, from, 0), 0);
+    XCTAssertEqualObjects([self convertRecord:from with:cd],
+                          @"Cafe\u0301 \u043F\u0440\u0441 tail");
+    /* Offsets must be at the start of a character in the indexed text. */
+    errno = 0;
+    XCTAssertEqual(bib_iconv_seek(cd, index, from, 4), -1);
+    XCTAssertEqual(errno, EINVAL);
+    errno = 0;
+    XCTAssertEqual(bib_iconv_seek(cd, index, from, 7), -1);
+    XCTAssertEqual(errno, EINVAL);
+    errno = 0;
+    XCTAssertEqual(bib_iconv_seek(cd, index, from, sizeof(from) + 1), -1);
+    XCTAssertEqual(errno, EINVAL);
+    bib_iconv_index_destroy(index);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvIovAcrossBuffers {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    /* Split a combining character from the character it modifies, and split
+     * both an escape sequence and an EACC character between buffers. */
+    char const from[] = "Caf\xE2" "e, \e$1\x21\x30\x21\e(B!";
+    struct iovec in[] = {
+        { (void *)(from + 0), 4 },
+        { (void *)(from + 4), 4 },
+        { (void *)(from + 8), 0 },
+        { (void *)(from + 8), 3 },
+        { (void *)(from + 11), 6 },
+    };
+    char destination[16] = { 0 };
+    struct iovec out[] = {
+        { destination + 0, 5 },
+        { destination + 5, 2 },
+        { destination + 7, 9 },
+    };
+    XCTAssertEqual(bib_iconv_iov(cd, in, 5, out, 3), 0);
+    XCTAssertEqual(bib_iconv_iov(cd, NULL, 0, out, 3), 0);
+    for (size_t index = 0; index < 5; index += 1) {
+        XCTAssertEqual(in[index].iov_len, 0);
+    }
+
+    /* Characters are split between destination buffers without any gaps. */
+    char const expected[] = "Cafe\u0301, \u4E00!";
+    XCTAssertEqual(out[2].iov_len, sizeof(destination) - strlen(expected));
+    XCTAssertEqual(memcmp(destination, expected, strlen(expected)), 0);
+
+    /* Running out of destination buffers stops the conversion, which resumes
+     * where it left off with more destination buffers. */
+    memset(destination, 0, sizeof(destination));
+    in[0] = (struct iovec){ (void *)from, strlen(from) };
+    out[0] = (struct iovec){ destination, 6 };
+    errno = 0;
+    XCTAssertEqual(bib_iconv_iov(cd, in, 1, out, 1), (size_t)-1);
+    XCTAssertEqual(errno, E2BIG);
+    out[0] = (struct iovec){ destination + 6, 10 };
+    XCTAssertEqual(bib_iconv_iov(cd, in, 1, out, 1), 0);
+    XCTAssertEqual(memcmp(destination, expected, strlen(expected)), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvBatch {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    /* Each string starts from the initial character sets, so the Cyrillic
+     * escape sequence in the first string doesn't carry over to the second. */
+    struct bib_span const in[] = {
+        { "\e(N\x41", 4 }, { "\x41", 1 }, { "ab\e)Zc", 6 },
+        { "Caf\xE2" "e", 5 }, { "", 0 },
+    };
+    struct bib_span out[5] = { 0 };
+    int status[5] = { 0 };
+    char destination[16] = { 0 };
+    XCTAssertEqual(bib_iconv_batch(cd, 5, in, out, status, destination,
+                                   sizeof(destination)), 5);
+    XCTAssertEqual(status[0], 0);
+    XCTAssertEqual(out[0].length, 2);
+    XCTAssertEqual(memcmp(out[0].data, "\u0430", 2), 0);
+    XCTAssertEqual(status[1], 0);
+    XCTAssertEqual(out[1].data, destination + 2);
+    XCTAssertEqual(memcmp(out[1].data, "A", out[1].length), 0);
+    /* A string that fails to convert doesn't stop the rest. */
+    XCTAssertEqual(status[2], EILSEQ);
+    XCTAssertEqual(out[2].length, 0);
+    XCTAssertEqual(status[3], 0);
+    XCTAssertEqual(out[3].data, destination + 3);
+    XCTAssertEqual(out[3].length, 6);
+    XCTAssertEqual(memcmp(out[3].data, "Cafe\u0301", 6), 0);
+    XCTAssertEqual(status[4], 0);
+    XCTAssertEqual(out[4].length, 0);
+
+    /* Running out of space stops at the string that doesn't fit, which can be
+     * converted along with the rest into another buffer. */
+    XCTAssertEqual(bib_iconv_batch(cd, 5, in, out, status, destination, 8), 3);
+    XCTAssertEqual(status[3], E2BIG);
+    XCTAssertEqual(bib_iconv_batch(cd, 2, in + 3, out + 3, status + 3,
+                                   destination, 8), 2);
+    XCTAssertEqual(status[3], 0);
+    XCTAssertEqual(out[3].data, destination);
+    XCTAssertEqual(out[3].length, 6);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvConvertAlloc {
+    struct arena arena = { .used = 0, .allocations = 0 };
+    struct bib_iconv_allocator const allocator = {
+        .allocate = arena_allocate,
+        .deallocate = arena_deallocate,
+        .context = &arena,
+    };
+    char const from[] = "Caf\xE2" "e, \e$1\x21\x30\x21\e(B!";
+    char *out = NULL;
+    size_t outlen = 0;
+    XCTAssertEqual(bib_iconv_convert_alloc("UTF-8", "MARC-8", from,
+                                           strlen(from), &out, &outlen,
+                                           &allocator), 0);
+    char const expected[] = "Cafe\u0301, \u4E00!";
+    XCTAssertEqual(outlen, strlen(expected));
+    XCTAssertEqual(memcmp(out, expected, outlen), 0);
+    /* The buffer is allocated once, with room for 3 bytes per MARC-8 byte. */
+    XCTAssertEqual(arena.allocations, 1);
+    XCTAssertEqual(arena.last_size, strlen(from) * 3);
+
+    XCTAssertEqual(bib_iconv_convert_alloc("UCS-2", "UTF-8", "ab\0cd", 5,
+                                           &out, &outlen, NULL), 0);
+    XCTAssertEqual(outlen, 6);
+    free(out);
+
+    errno = 0;
+    XCTAssertEqual(bib_iconv_convert_alloc("UTF-8", "MARC-8", "ab\e)Zc", 6,
+                                           &out, &outlen, NULL), (size_t)-1);
+    XCTAssertEqual(errno, EILSEQ);
+    XCTAssertTrue(out == NULL);
+}
+
+- (void)testIconvConvertParallel {
+    /* Switch to Cyrillic and back in the middle of the text, so that some
+     * chunks begin in a different character set than the initial one. */
+    NSMutableData *text = [NSMutableData data];
+    for (int count = 0; count < 50000; count += 1) {
+        char const *piece = "Caf\xE2" "e au lait, ";
+        if (count % 1000 == 300) {
+            piece = "\e(N\x50\x52 ";
+        } else if (count % 1000 == 800) {
+            piece = "\e(B ";
+        }
+        [text appendBytes:piece length:strlen(piece)];
+    }
+    struct bib_iconv_executor const executor = {
+        .apply = dispatch_apply_auto,
+        .context = NULL,
+        .width = 8,
+    };
+    char *expected = NULL;
+    size_t expectedlen = 0;
+    XCTAssertEqual(bib_iconv_convert_alloc("UTF-8", "MARC-8", text.bytes,
+                                           text.length, &expected,
+                                           &expectedlen, NULL), 0);
+    char *out = NULL;
+    size_t outlen = 0;
+    XCTAssertEqual(bib_iconv_convert_parallel("UTF-8", "MARC-8", text.bytes,
+                                              text.length, &out, &outlen,
+                                              &executor, NULL), 0);
+    XCTAssertEqual(outlen, expectedlen);
+    XCTAssertEqual(memcmp(out, expected, outlen), 0);
+    free(expected);
+    free(out);
+
+    /* An invalid escape sequence at the end fails just like converting on a
+     * single thread. */
+    [text appendBytes:"\e)Z" length:3];
+    errno = 0;
+    XCTAssertEqual(bib_iconv_convert_parallel("UTF-8", "MARC-8", text.bytes,
+                                              text.length, &out, &outlen,
+                                              &executor, NULL), (size_t)-1);
+    XCTAssertEqual(errno, EILSEQ);
+    XCTAssertTrue(out == NULL);
+}
+
+- (void)testIconvOpenAllocator {
+    struct arena arena = { .used = 0, .allocations = 0 };
+    struct bib_iconv_allocator const allocator = {
+        .allocate = arena_allocate,
+        .deallocate = arena_deallocate,
+        .context = &arena,
+    };
+    /* The descriptor and its MARC-8 decoder state are a single allocation. */
+    bib_iconv_t cd = bib_iconv_open_allocator("UTF-8", "MARC-8", &allocator);
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    XCTAssertEqual(arena.allocations, 1);
+    XCTAssertEqualObjects([self convertRecord:"Caf\xE2" "e" with:cd],
+                          @"Cafe\u0301");
+    XCTAssertEqual(arena.allocations, 1);
+    bib_iconv_close(cd);
+    XCTAssertEqual(arena.deallocations, 1);
+
+    /* Pools allocate everything with the global allocator. */
+    bib_iconv_set_allocator(&allocator);
+    bib_iconv_pool_t pool = bib_iconv_pool_create();
+    cd = bib_iconv_pool_acquire(pool, "UCS-2", "MARC-8");
+    bib_iconv_pool_release(pool, cd);
+    bib_iconv_set_allocator(NULL);
+    bib_iconv_pool_destroy(pool);
+    XCTAssertEqual(arena.allocations, 4);
+    XCTAssertEqual(arena.deallocations, 4);
+
+    /* Running out of memory in the allocator fails to open a descriptor. */
+    arena.used = sizeof(arena.bytes);
+    errno = 0;
+    XCTAssertEqual(bib_iconv_open_allocator("UTF-8", "MARC-8", &allocator),
+                   (bib_iconv_t)-1);
+    XCTAssertEqual(errno, ENOMEM);
+}
+
+- (void)testIconvMARC8ToUTF8InSmallBuffers {
+    bib_iconv_t cd = bib_iconv_open("utf8", "marc8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    char const from[] = "Hello world, \e$1\x21\x30\x2D\e(B and caf\xE2"
+                        "e again!";
+    char const *src = from;
+    size_t srclen = sizeof(from);
+    char destination[64] = { 0 };
+    char *dst = destination;
+    size_t dstlen = 0;
+    size_t result = 0;
+    do {
+        dstlen = MIN(9, (size_t)(destination + sizeof(destination) - dst));
+        result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+    } while (dstlen == 0 || (result == (size_t)-1 && errno == E2BIG));
+    XCTAssertEqual(result, 0);
+    XCTAssertEqual(strcmp("Hello world, \u4E16 and cafe\u0301 again!",
+                          destination), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8ASCIIRunsToUTF16 {
+    bib_iconv_t cd = bib_iconv_open("UCS-2", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    char const from[] = "An ASCII run longer than sixteen bytes, "
+                        "\e(Sab\e(B then ASCII again, caf\xE2"
+                        "e, and the end of the record.";
+    char16_t const expected[] = u"An ASCII run longer than sixteen bytes, "
+                                u"\u03B1\u03B2 then ASCII again, cafe\u0301, "
+                                u"and the end of the record.";
+    char const *src = from;
+    size_t srclen = sizeof(from);
+    char16_t destination[128] = { 0 };
+    char *dst = (char *)destination;
+    size_t dstlen = sizeof(destination);
+    size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+    XCTAssertEqual(result, 0);
+    XCTAssertEqual(sizeof(destination) - dstlen, sizeof(expected));
+    XCTAssertEqual(memcmp(expected, destination, sizeof(expected)), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8CyrillicRunsToUTF32 {
+    bib_iconv_t cd = bib_iconv_open("UTF-32", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    char const from[] = "\e(N\x50\x52\x49\x57\x45\x54 \x4D\x49\x52, \e(B\e)N"
+                        "Moscow is \xED\xEF\xF3\xEB\xF7\xE1 in Russian.";
+    char32_t const expected[] = U"\u043F\u0440\u0438\u0432\u0435\u0442 "
+                                U"\u043C\u0438\u0440, Moscow is "
+                                U"\u041C\u041E\u0421\u041A\u0412\u0410 "
+                                U"in Russian.";
+    char const *src = from;
+    size_t srclen = sizeof(from);
+    char32_t destination[64] = { 0 };
+    char *dst = (char *)destination;
+    size_t dstlen = sizeof(destination);
+    size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+    XCTAssertEqual(result, 0);
+    XCTAssertEqual(sizeof(destination) - dstlen, sizeof(expected));
+    XCTAssertEqual(memcmp(expected, destination, sizeof(expected)), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8EscapeDenseToUTF8 {
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    XCTAssertNotEqual(cd, (bib_iconv_t)-1);
+    char const from[] = "\e(N\x50\x52\e(B ab \e)N\xED\xEF\e)!E\xE1" "a";
+    char const expected[] = "\u043F\u0440 ab \u041C\u041Ea\u0300";
+    char const *src = from;
+    size_t srclen = sizeof(from);
+    char destination[64] = { 0 };
+    char *dst = destination;
+    size_t dstlen = sizeof(destination);
+    size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+    XCTAssertEqual(result, 0);
+    XCTAssertEqual(sizeof(destination) - dstlen, sizeof(expected));
+    XCTAssertEqual(strcmp(expected, destination), 0);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8EscapeSequences {
+    struct { char const *from; ucs4_t expected; } const valid[] = {
+        { "\e(BA", 0x0041 },
+        { "\e,NA", 0x0430 },
+        { "\e(!E\x30", 0x02BB },
+        { "\e)!E\xB0", 0x02BB },
+        { "\e-Q\xC1", 0x0452 },
+        { "\e)3\xC1", 0x0621 },
+        { "\e$1\x21\x30\x21", 0x4E00 },
+        { "\e$,1\x21\x30\x21", 0x4E00 },
+        { "\e$)1\xA1\xB0\xA1", 0x4E00 },
+    };
+    for (size_t index = 0; index < sizeof(valid) / sizeof(*valid); index += 1) {
+        bib_iconv_t cd = bib_iconv_open("UTF-32", "MARC-8");
+        char const *src = valid[index].from;
+        size_t srclen = strlen(src) + 1;
+        char32_t destination[4] = { 0 };
+        char *dst = (char *)destination;
+        size_t dstlen = sizeof(destination);
+        XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), 0);
+        XCTAssertEqual(destination[0], valid[index].expected);
+        bib_iconv_close(cd);
+    }
+    char const *const invalid[] = { "\e(!B", "\e(1", "\e$!1", "\e)", "\ez" };
+    for (size_t index = 0; index < sizeof(invalid) / sizeof(*invalid);
+         index += 1) {
+        bib_iconv_t cd = bib_iconv_open("UTF-32", "MARC-8");
+        char const *src = invalid[index];
+        size_t srclen = strlen(src) + 1;
+        char32_t destination[4] = { 0 };
+        char *dst = (char *)destination;
+        size_t dstlen = sizeof(destination);
+        errno = 0;
+        XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+        XCTAssertEqual(errno, EILSEQ);
+        XCTAssertEqual(src, invalid[index]);
+        bib_iconv_close(cd);
+    }
+}
+
+- (void)testIconvMARC8IncompleteSequences {
+    /* Escape sequences and multibyte characters cut short at the end of the
+     * source buffer are left in it, to be read again with the rest. */
+    struct {
+        char const *from;
+        size_t consumed;
+    } const cases[] = {
+        { "ab\e$", 2 }, { "ab\e(", 2 }, { "\e$1\x21\x30", 3 },
+        { "a\xE1", 1 },
+    };
+    for (size_t index = 0; index < sizeof(cases) / sizeof(*cases);
+         index += 1) {
+        bib_iconv_t cd = bib_iconv_open("UTF-32", "MARC-8");
+        char const *src = cases[index].from;
+        size_t srclen = strlen(src);
+        char32_t destination[4] = { 0 };
+        char *dst = (char *)destination;
+        size_t dstlen = sizeof(destination);
+        errno = 0;
+        XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+        XCTAssertEqual(errno, EINVAL);
+        XCTAssertEqual(src, cases[index].from + cases[index].consumed);
+        bib_iconv_close(cd);
+    }
+}
+
+- (void)testIconvMARC8ToOneByteBuffers {
+    /* Characters that don't fit in the destination buffer are written a byte
+     * at a time across calls. */
+    char const from[] = "Caf\xE2" "e, \e$1\x21\x30\x21\e(B!";
+    char const expected[] = "Cafe\u0301, \u4E00!";
+    bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+    char const *src = from;
+    size_t srclen = strlen(from);
+    char destination[32] = { 0 };
+    char *dst = destination;
+    size_t calls = 0;
+    while (dst < destination + sizeof(destination) - 1) {
+        size_t dstlen = 1;
+        size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+        calls += 1;
+        if (result == (size_t)-1) {
+            if (errno == E2BIG) {
+                continue;
+            }
+            XCTAssertEqual(errno, EINVAL);
+            XCTAssertEqual(srclen, 0);
+        }
+        if (dstlen > 0) {
+            break;
+        }
+    }
+    XCTAssertEqual(strcmp(destination, expected), 0);
+    XCTAssertEqual(calls, strlen(expected) + 1);
+    bib_iconv_close(cd);
+}
+
+- (void)testIconvMARC8CombiningCharacterLimit {
+    char from[40] = { 0 };
+    memset(from, 0xE1, 32);
+    from[32] = 'a';
+    bib_iconv_t cd = bib_iconv_open("UTF-32", "MARC-8");
+    char const *src = from;
+    size_t srclen = strlen(from) + 1;
+    char32_t destination[40] = { 0 };
+    char *dst = (char *)destination;
+    size_t dstlen = sizeof(destination);
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), 0);
+    XCTAssertEqual(destination[0], U'a');
+    XCTAssertEqual(destination[32], U'\u0300');
+    XCTAssertEqual(destination[33], 0);
+    bib_iconv_close(cd);
+
+    /* One more combining character than the decoder can hold rejects the
+     * whole run of them. */
+    memset(from, 0xE1, 33);
+    from[33] = 'a';
+    cd = bib_iconv_open("UTF-32", "MARC-8");
+    src = from;
+    srclen = strlen(from) + 1;
+    dst = (char *)destination;
+    dstlen = sizeof(destination);
+    errno = 0;
+    XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), (size_t)-1);
+    XCTAssertEqual(errno, EILSEQ);
+    XCTAssertEqual(src, from);
+    XCTAssertEqual(dstlen, sizeof(destination));
+    bib_iconv_close(cd);
+}
+
+/**
+ * Measure converting records that shift between the Latin, Cyrillic, and
+ * Greek character sets every few characters.
+ */
+- (void)testIconvMARC8EscapeDensePerformance {
+    char const pattern[] = "\e(N\x50\x52\e(B ab \e)N\xED\xEF\e)!E\xE1" "a"
+                           "\e(S\x41\x42\e(B, ";
+    NSMutableData *input = [NSMutableData data];
+    for (int count = 0; count < 4096; count += 1) {
+        [input appendBytes:pattern length:sizeof(pattern) - 1];
+    }
+    [input appendBytes:"" length:1];
+    NSMutableData *output = [NSMutableData dataWithLength:input.length * 3];
+    [self measureBlock:^{
+        bib_iconv_t cd = bib_iconv_open("UTF-8", "MARC-8");
+        char const *src = input.bytes;
+        size_t srclen = input.length;
+        char *dst = output.mutableBytes;
+        size_t dstlen = output.length;
+        XCTAssertEqual(bib_iconv(cd, &src, &srclen, &dst, &dstlen), 0);
+        bib_iconv_close(cd);
+    }];
+}
+
+/**
+ * Convert a single MARC-8 character with the fused converters, and check the
+ * output against the character set's code table and the generic conversion
+ * from UTF-32. Combining characters are followed by a space to attach to.
+ *
+ * - returns: `NO` when the conversion doesn't match.
+ */
+- (BOOL)checkFusedConversionWithEscape:(char const *)escape
+                                 units:(char const *)units
+                                length:(size_t)length
+                               charset:(bib_iconv_charset_t const *)charset {
+    size_t location = 0;
+    ucs4_t unicode = 0;
+    bool is_combining = false;
+    if (!bib_iconv_charset_lookup(charset, length, units, &location, &unicode,
+                                  &is_combining)) {
+        return YES;
+    }
+    if (unicode == 0 || unicode == UCS4_IGNORED) {
+        return YES;
+    }
+
+    char from[16] = { 0 };
+    size_t escape_length = strlen(escape);
+    memcpy(from, escape, escape_length);
+    memcpy(from + escape_length, units, length);
+    if (is_combining) {
+        from[escape_length + length] = ' ';
+    }
+    ucs4_t const expected[] = {
+        is_combining ? ' ' : unicode, is_combining ? unicode : 0, 0
+    };
+    size_t const expected_length = is_combining ? 3 : 2;
+
+    char const *encodings[] = { "UTF-32", "UTF-8", "UCS-2" };
+    char outputs[3][32] = { 0 };
+    size_t output_lengths[3] = { 0 };
+    for (int index = 0; index < 3; index += 1) {
+        bib_iconv_t cd = bib_iconv_open(encodings[index], "MARC-8");
+        char const *src = from;
+        size_t srclen = escape_length + length + (is_combining ? 2 : 1);
+        char *dst = outputs[index];
+        size_t dstlen = sizeof(outputs[index]);
+        size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+        bib_iconv_close(cd);
+        XCTAssertEqual(result, 0);
+        if (result != 0) {
+            return NO;
+        }
+        output_lengths[index] = sizeof(outputs[index]) - dstlen;
+    }
+    BOOL const matches_table =
+        output_lengths[0] == expected_length * sizeof(ucs4_t)
+        && memcmp(outputs[0], expected, output_lengths[0]) == 0;
+    XCTAssertTrue(matches_table);
+    if (!matches_table) {
+        return NO;
+    }
+
+    for (int index = 1; index < 3; index += 1) {
+        bib_iconv_t cd = bib_iconv_open(encodings[index], "UTF-32");
+        char const *src = (char const *)expected;
+        size_t srclen = sizeof(ucs4_t) * expected_length;
+        char generic[32] = { 0 };
+        char *dst = generic;
+        size_t dstlen = sizeof(generic);
+        size_t result = bib_iconv(cd, &src, &srclen, &dst, &dstlen);
+        bib_iconv_close(cd);
+        XCTAssertEqual(result, 0);
+        XCTAssertEqual(output_lengths[index], sizeof(generic) - dstlen);
+        XCTAssertEqual(memcmp(outputs[index], generic, sizeof(generic)), 0);
+        if (result != 0 || memcmp(outputs[index], generic, sizeof(generic))) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (void)testFusedConvertersMatchCodeTables {
+    struct {
+        struct bib_iconv_charset const *charset;
+        char const *g0_escape;
+        char const *g1_escape;
+    } const charsets[] = {
+        { &bib_iconv_marc8_basic_latin, "\e(B", "\e)B" },
+        { &bib_iconv_marc8_extended_latin, "\e(!E", "\e)!E" },
+        { &bib_iconv_marc8_greek_symbols, "\eg", nullptr },
+        { &bib_iconv_marc8_subscript, "\eb", nullptr },
+        { &bib_iconv_marc8_superscript, "\ep", nullptr },
+        { &bib_iconv_marc8_basic_hebrew, "\e(2", "\e)2" },
+        { &bib_iconv_marc8_basic_cyrillic, "\e(N", "\e)N" },
+        { &bib_iconv_marc8_extended_cyrillic, "\e(Q", "\e)Q" },
+        { &bib_iconv_marc8_basic_arabic, "\e(3", "\e)3" },
+        { &bib_iconv_marc8_extended_arabic, "\e(4", "\e)4" },
+        { &bib_iconv_marc8_basic_greek, "\e(S", "\e)S" },
+    };
+    for (size_t index = 0; index < sizeof(charsets) / sizeof(*charsets);
+         index += 1) {
+        struct bib_iconv_charset const *charset = charsets[index].charset;
+        char const *g0_escape = charsets[index].g0_escape;
+        char const *g1_escape = charsets[index].g1_escape;
+        for (int unit = 0x21; unit < 0x7F; unit += 1) {
+            char const g0_units[1] = { (char)unit };
+            if (![self checkFusedConversionWithEscape:g0_escape units:g0_units
+                                               length:1 charset:charset]) {
+                return;
+            }
+            char const g1_units[1] = { (char)(unit | 0x80) };
+            if (g1_escape != nullptr
+                && ![self checkFusedConversionWithEscape:g1_escape
+                                                   units:g1_units
+                                                  length:1 charset:charset]) {
+                return;
+            }
+        }
+    }
+    struct bib_iconv_charset const *eacc = &bib_iconv_marc8_eacc;
+    for (int first = 0x21; first < 0x7F; first += 1) {
+        for (int second = 0x21; second < 0x7F; second += 1) {
+            for (int third = 0x21; third < 0x7F; third += 1) {
+                char const units[3] = {
+                    (char)first, (char)second, (char)third
+                };
+                if (![self checkFusedConversionWithEscape:"\e$1" units:units
+                                                   length:3
+                                                  charset:eacc]) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
 - (void)testIconvOpenUTF8ToMARC8Failure {
     /* Conversion to MARC-8 is not yet supported. */
     bib_iconv_t cd = bib_iconv_open("marc8", "utf8");